@@ -123,6 +123,10 @@ def populateDict():
 
     add_int("simulation/AMR/max_nbr_levels", simulation.max_nbr_levels)
     add_vector_int("simulation/AMR/nesting_buffer", simulation.nesting_buffer)
+    add_string("simulation/AMR/load_balancing/mode", simulation.load_balancing)
+    add_double("simulation/AMR/load_balancing/field_weight", simulation.load_balancing_field_weight)
+    add_size_t("simulation/AMR/load_balancing/rebalance_interval", simulation.rebalance_interval)
+    add_double("simulation/AMR/load_balancing/rebalance_threshold", simulation.rebalance_threshold)
     refinement_boxes = simulation.refinement_boxes
 
 
@@ -161,14 +165,29 @@ def populateDict():
         add_string("simulation/AMR/refinement/tagging/method","none") # integrator.h might want some looking at
 
     add_string("simulation/algo/ion_updater/pusher/name", simulation.particle_pusher)
+    add_size_t("simulation/algo/ion_updater/sort/interval", simulation.particle_sort_interval)
+    add_size_t("simulation/algo/ion_updater/nbr_threads", simulation.nbr_threads_per_patch)
+    add_size_t("simulation/algo/nbr_threads", simulation.nbr_threads)
+    add_int("simulation/algo/overlap_ghost_exchange", simulation.overlap_ghost_exchange)
+    add_int("simulation/algo/sum_border_moments", simulation.sum_border_moments)
     add_double("simulation/algo/ohm/resistivity", simulation.resistivity)
     add_double("simulation/algo/ohm/hyper_resistivity", simulation.hyper_resistivity)
 
+    if simulation.restart_options is not None:
+        restart_path = "simulation/restarts/"
+        restart_options = simulation.restart_options
+        add_string(restart_path + "dir", restart_options["dir"])
+        add_size_t(restart_path + "interval", restart_options["interval"])
+        add_double(restart_path + "seconds", restart_options["seconds"])
+        if "restart_index" in restart_options:
+            add_int(restart_path + "restart_index", restart_options["restart_index"])
+
 
     init_model = simulation.model
     modelDict  = init_model.model_dict
 
     add_int("simulation/ions/nbrPopulations", init_model.nbr_populations())
+    add_size_t("simulation/ions/nbr_threads", simulation.nbr_threads_per_patch)
 
 
     partinit = "particle_initializer"
@@ -179,6 +198,7 @@ def populateDict():
         add_string(pop_path+"{:d}/name".format(pop_index), pop)
         add_double(pop_path+"{:d}/mass".format(pop_index), d["mass"])
         add_string(partinit_path+"name", "maxwellian")
+        add_string(partinit_path+"population", pop)
 
         addInitFunction(partinit_path+"density", fn_wrapper(d["density"]))
         addInitFunction(partinit_path+"bulk_velocity_x", fn_wrapper(d["vx"]))
@@ -210,6 +230,13 @@ def populateDict():
         add_string(name_path + "/" + 'type' , diag.type)
         add_string(name_path + "/" + 'quantity' , diag.quantity)
         add_size_t(name_path + "/" + "flush_every", diag.flush_every)
+        add_size_t(name_path + "/" + "chunk_size", diag.chunk_size)
+        add_size_t(name_path + "/" + "compression", diag.compression)
+        add_size_t(name_path + "/" + "float32", int(diag.float32))
+        if diag.type == "particle":
+            add_size_t(name_path + "/" + "subsample", diag.subsample)
+            if diag.select_box is not None:
+                add_vector_int(name_path + "/" + "select_box", diag.select_box)
         pp.add_array_as_vector(name_path + "/" + "write_timestamps", diag.write_timestamps)
         pp.add_array_as_vector(name_path + "/" + "compute_timestamps", diag.compute_timestamps)
         add_size_t(name_path + "/" + 'n_attributes' , len(diag.attributes))
@@ -229,6 +256,10 @@ def populateDict():
             add_string(diag_path + "mode", simulation.diag_options["options"]["mode"])
         if "fine_dump_lvl_max" in simulation.diag_options["options"]:
             add_int(diag_path + "fine_dump_lvl_max", simulation.diag_options["options"]["fine_dump_lvl_max"])
+        if "async_queue_size" in simulation.diag_options["options"]:
+            add_size_t(diag_path + "async_queue_size", simulation.diag_options["options"]["async_queue_size"])
+        if "layout" in simulation.diag_options["options"]:
+            add_string(diag_path + "layout", simulation.diag_options["options"]["layout"])
 
 
     #### adding electrons
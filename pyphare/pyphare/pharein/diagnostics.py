@@ -16,7 +16,8 @@ def diagnostics_checker(func):
         if len(missing_mandatory_kwds) > 0:
             raise RuntimeError("Error: missing mandatory parameters : " + ', '.join(missing_mandatory_kwds))
 
-        accepted_keywords = ['path', 'compute_timestamps', 'population_name', 'flush_every']
+        accepted_keywords = ['path', 'compute_timestamps', 'population_name', 'flush_every',
+                             'chunk_size', 'compression', 'float32', 'subsample', 'select_box']
         accepted_keywords += mandatory_keywords
 
         # check that all passed keywords are in the accepted keyword list
@@ -95,12 +96,30 @@ class Diagnostics(object):
         for key in self.attributes:
             self.attributes[key] = self.attributes[key]
 
+        if self.type != ParticleDiagnostics.type and any([k in kwargs for k in ["subsample", "select_box"]]):
+            raise RuntimeError(f"{self.__class__.__name__} does not accept subsample or select_box")
+
         self._setSubTypeAttributes(**kwargs)
         self.flush_every = kwargs.get("flush_every", 1) # flushes every dump, safe, but costly
 
         if self.flush_every < 0:
             raise RuntimeError(f"{self.__class__.__name__,}.flush_every cannot be negative")
 
+        # chunk_size: rows of the first dimension per HDF5 chunk, 0 is contiguous
+        # compression: deflate level from 1 to 9, 0 is uncompressed
+        #   not supported with parallel HDF5 on more than one MPI process
+        # float32: fields and particle velocities are stored in single precision
+        self.chunk_size = kwargs.get("chunk_size", 0)
+        self.compression = kwargs.get("compression", 0)
+        self.float32 = kwargs.get("float32", False)
+
+        if not isinstance(self.chunk_size, int) or self.chunk_size < 0:
+            raise RuntimeError(f"{self.__class__.__name__}.chunk_size should be a positive integer")
+        if not isinstance(self.compression, int) or not 0 <= self.compression <= 9:
+            raise RuntimeError(f"{self.__class__.__name__}.compression should be in [0, 9]")
+        if not isinstance(self.float32, bool):
+            raise RuntimeError(f"{self.__class__.__name__}.float32 should be a boolean")
+
         if any([self.quantity == diagnostic.quantity for diagnostic in global_vars.sim.diagnostics]):
             raise RuntimeError(f"Error: Diagnostic ({kwargs['quantity']}) already registered")
 
@@ -226,6 +245,23 @@ class ParticleDiagnostics(Diagnostics):
 
         self.quantity = "/ions/pop/" + self.population_name + "/" + self.quantity
 
+        # subsample: every nth particle is written, 1 writes them all
+        # select_box: only particles in the cells of this level 0 box are written,
+        #             given as (lower, upper) cells, e.g. ((10,), (20,)) in 1D
+        self.subsample = kwargs.get("subsample", 1)
+        self.select_box = kwargs.get("select_box", None)
+
+        if not isinstance(self.subsample, int) or self.subsample < 1:
+            raise RuntimeError(f"{self.__class__.__name__}.subsample should be a strictly positive integer")
+        if self.select_box is not None:
+            lower, upper = self.select_box
+            ndim = global_vars.sim.ndim
+            if len(lower) != ndim or len(upper) != ndim:
+                raise RuntimeError(f"{self.__class__.__name__}.select_box should be {ndim}D")
+            if any([l > u for l, u in zip(lower, upper)]):
+                raise RuntimeError(f"{self.__class__.__name__}.select_box lower cells should not exceed upper cells")
+            self.select_box = [int(i) for i in list(lower) + list(upper)]
+
     def space_box(self, **kwargs):
 
         if 'extent' not in kwargs and self.quantity == 'space_box':
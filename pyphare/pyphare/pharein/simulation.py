@@ -129,7 +129,7 @@ def check_interp_order(**kwargs):
 
 def check_pusher(**kwargs):
     pusher = kwargs.get('particle_pusher', 'modified_boris')
-    if pusher not in ['modified_boris']:
+    if pusher not in ['modified_boris', 'modified_boris_simd']:
         raise ValueError('Error: invalid pusher ({})'.format(pusher))
     return pusher
 
@@ -137,6 +137,38 @@ def check_pusher(**kwargs):
 # ------------------------------------------------------------------------------
 
 
+def check_particle_sort_interval(**kwargs):
+    interval = kwargs.get('particle_sort_interval', 0)
+    if not isinstance(interval, int) or interval < 0:
+        raise ValueError('Error: particle_sort_interval should be a positive integer')
+    return interval
+
+
+
+def check_nbr_threads(key, **kwargs):
+    nbr_threads = kwargs.get(key, 1)
+    if not isinstance(nbr_threads, int) or nbr_threads < 1:
+        raise ValueError(f'Error: {key} should be a strictly positive integer')
+    return nbr_threads
+
+
+
+def check_overlap_ghost_exchange(**kwargs):
+    overlap = kwargs.get('overlap_ghost_exchange', False)
+    if not isinstance(overlap, bool):
+        raise ValueError('Error: overlap_ghost_exchange should be a boolean')
+    return overlap
+
+
+
+def check_sum_border_moments(**kwargs):
+    sum_moments = kwargs.get('sum_border_moments', False)
+    if not isinstance(sum_moments, bool):
+        raise ValueError('Error: sum_border_moments should be a boolean')
+    return sum_moments
+
+
+
 def check_layout(**kwargs):
     layout = kwargs.get('layout', 'yee')
     if layout not in ('yee'):
@@ -373,12 +405,50 @@ def check_diag_options(**kwargs):
                     raise ValueError ("1. Creation of the directory %s failed" % diag_dir)
             except FileExistsError:
                 raise ValueError ("Creation of the directory %s failed" % diag_dir)
+        if "options" in diag_options and "async_queue_size" in diag_options["options"]:
+            queue_size = diag_options["options"]["async_queue_size"]
+            if not isinstance(queue_size, int) or queue_size < 0:
+                raise ValueError("Error: diag_options async_queue_size should be a positive integer")
+        if "options" in diag_options and "layout" in diag_options["options"]:
+            if diag_options["options"]["layout"] not in ["patch", "level"]:
+                raise ValueError("Error: diag_options layout should be 'patch' or 'level'")
     return diag_options
 
 
 
 
 
+def check_restart_options(**kwargs):
+    restart_options = kwargs.get("restart_options", None)
+    if restart_options is None:
+        return None
+
+    valid_keys = ["dir", "interval", "seconds", "restart_index"]
+    for key in restart_options:
+        if key not in valid_keys:
+            raise ValueError(f"Error: invalid restart_options key {key}, should be one of {valid_keys}")
+
+    restart_options = dict(restart_options)
+    restart_options["dir"] = restart_options.get("dir", "checkpoints")
+    restart_options["interval"] = restart_options.get("interval", 0)
+    restart_options["seconds"] = restart_options.get("seconds", 0)
+
+    interval = restart_options["interval"]
+    if not isinstance(interval, int) or interval < 0:
+        raise ValueError("Error: restart_options interval should be a positive integer")
+    if restart_options["seconds"] < 0:
+        raise ValueError("Error: restart_options seconds should not be negative")
+    if "restart_index" in restart_options:
+        index = restart_options["restart_index"]
+        if not isinstance(index, int) or index < 0:
+            raise ValueError("Error: restart_options restart_index should be a positive integer")
+
+    return restart_options
+
+
+
+
+
 def check_refinement(**kwargs):
     return kwargs.get("refinement", "boxes")
 
@@ -441,6 +511,32 @@ def check_hyper_resistivity(**kwargs):
 
 
 
+def check_load_balancing(**kwargs):
+    load_balancing = kwargs.get("load_balancing", "cells")
+    if load_balancing not in ["cells", "particles"]:
+        raise ValueError('Error: load_balancing should be "cells" or "particles"')
+
+    field_weight = kwargs.get("load_balancing_field_weight", 1.0)
+    if field_weight < 0.0:
+        raise ValueError("Error: load_balancing_field_weight should not be negative")
+
+    return load_balancing, field_weight
+
+
+
+def check_rebalancing(**kwargs):
+    interval = kwargs.get('rebalance_interval', 0)
+    if not isinstance(interval, int) or interval < 0:
+        raise ValueError('Error: rebalance_interval should be a positive integer')
+
+    threshold = kwargs.get('rebalance_threshold', 1.2)
+    if threshold < 1.0:
+        raise ValueError('Error: rebalance_threshold should be greater or equal to 1')
+
+    return interval, threshold
+
+
+
 # ------------------------------------------------------------------------------
 
 def checker(func):
@@ -450,7 +546,11 @@ def checker(func):
                              'boundary_types', 'refined_particle_nbr', 'path', 'nesting_buffer',
                              'diag_export_format', 'refinement_boxes', 'refinement', 'init_time',
                              'smallest_patch_size', 'largest_patch_size', "diag_options",
-                             'resistivity', 'hyper_resistivity', 'strict' ]
+                             'resistivity', 'hyper_resistivity', 'strict', 'particle_sort_interval',
+                             'nbr_threads', 'nbr_threads_per_patch', 'overlap_ghost_exchange',
+                             'sum_border_moments', 'load_balancing',
+                             'load_balancing_field_weight', 'rebalance_interval',
+                             'rebalance_threshold', 'restart_options' ]
 
         accepted_keywords += check_optional_keywords(**kwargs)
 
@@ -477,11 +577,17 @@ def checker(func):
         kwargs["refinement_ratio"] = 2
 
         kwargs["particle_pusher"] = check_pusher(**kwargs)
+        kwargs["particle_sort_interval"] = check_particle_sort_interval(**kwargs)
+        kwargs["nbr_threads"] = check_nbr_threads("nbr_threads", **kwargs)
+        kwargs["nbr_threads_per_patch"] = check_nbr_threads("nbr_threads_per_patch", **kwargs)
+        kwargs["overlap_ghost_exchange"] = check_overlap_ghost_exchange(**kwargs)
+        kwargs["sum_border_moments"] = check_sum_border_moments(**kwargs)
         kwargs["layout"] = check_layout(**kwargs)
         kwargs["path"] = check_path(**kwargs)
 
         ndim = compute_dimension(cells)
         kwargs["diag_options"] = check_diag_options(**kwargs)
+        kwargs["restart_options"] = check_restart_options(**kwargs)
 
         kwargs["boundary_types"] = check_boundaries(ndim, **kwargs)
         kwargs["origin"] = check_origin(ndim, **kwargs)
@@ -508,6 +614,14 @@ def checker(func):
 
         kwargs["hyper_resistivity"] = check_hyper_resistivity(**kwargs)
 
+        load_balancing, field_weight = check_load_balancing(**kwargs)
+        kwargs["load_balancing"] = load_balancing
+        kwargs["load_balancing_field_weight"] = field_weight
+
+        rebalance_interval, rebalance_threshold = check_rebalancing(**kwargs)
+        kwargs["rebalance_interval"] = rebalance_interval
+        kwargs["rebalance_threshold"] = rebalance_threshold
+
         return func(simulation_object, **kwargs)
 
     return wrapper
@@ -534,15 +648,36 @@ class Simulation(object):
     layout               : layout of the physical quantities on the mesh (default = "yee")
     origin               : origin of the physical domain, (default (0,0,0) in 3D)
     refined_particle_nbr : number of refined particles for particle splitting ( TODO default hard-coded to 2)
-    particle_pusher      : algo to push particles (default = "modifiedBoris")
+    particle_pusher      : algo to push particles (default = "modified_boris", or "modified_boris_simd")
+    particle_sort_interval : number of time steps between sorts of particles by cell (default 0, never sort)
+    nbr_threads          : number of threads per MPI rank advancing the patches of a level (default 1)
+    nbr_threads_per_patch : number of threads loading, pushing and depositing the particles of a patch (default 1)
+    overlap_ghost_exchange : push the bulk of the particles while ghost particles are exchanged, on levels where
+                           no particle can cross a cell in a step (default False)
+    sum_border_moments   : sum ion moments on nodes shared by patches rather than depositing patch ghost particles, which are then only exchanged within a cell of the patches (default False)
     path                 : path for outputs (default : './')
     boundary_types       : type of boundary conditions (default is "periodic" for each direction)
     diag_export_format   : format of the output diagnostics (default= "phareh5")
+    diag_options         : [default=None] {"format": "phareh5", "options": {"dir": path, "mode": "overwrite",
+                           "async_queue_size": N}}, with N > 0, dumps return once their data is copied and
+                           a background thread writes it, with at most N datasets pending (default 0, synchronous)
+                           "layout": "level" writes one dataset per quantity and level instead of one per
+                           patch (default "patch"), files are read the same way by pyphare.pharesee
+    restart_options      : [default=None] {"dir": "checkpoints", "interval": steps, "seconds": wall time,
+                           "restart_index": step} writes restart files every "interval" steps and/or
+                           "seconds" of wall time (0 is never), and restarts from the restart files of
+                           step "restart_index" if given. The restarted run is identical to an uninterrupted
+                           one on the same number of MPI ranks, on another number levels are regridded
+                           from the restarted ones
     nesting_buffer       : [default=0] minimum gap in coarse cells from border between coarse and refined patch
     refinement_boxes     : [default=None] {"L0":{"B0":[(lox,loy,loz),(upx,upy,upz)],...,"Bi":[(),()]},..."Li":{B0:[(),()]}}
     smallest_patch_size  :
     largest_patch_size   :
     max_nbr_levels       : [default=1] max number of levels in the hierarchy if refinement_boxes != "boxes"
+    load_balancing       : what patches are balanced on, "cells" (default) or "particles" per cell
+    load_balancing_field_weight : cost of the field solve per cell, in particle pushes (default 1.)
+    rebalance_interval   : number of time steps between checks of the load imbalance (default 0, never)
+    rebalance_threshold  : largest over average rank work time above which the coarsest level is rebalanced (default 1.2)
     init_time            : unused for now, will be time for restarts someday
     strict               : bool, turns warnings into errors (default False)
 
@@ -4,6 +4,7 @@ import os
 import numpy as np
 
 from .particles import Particles
+from .level_layout import is_level_layout, LevelLayoutFile
 
 from ..core import box as boxm
 from ..core.box import Box
@@ -1011,6 +1012,8 @@ h5_time_grp_key = "t"
 def hierarchy_fromh5(h5_filename, time, hier, silent=True):
     import h5py
     data_file = h5py.File(h5_filename, "r")
+    if is_level_layout(data_file):
+        data_file = LevelLayoutFile(data_file)
     basename = os.path.basename(h5_filename)
 
     root_cell_width = np.asarray(data_file.attrs["cell_width"])
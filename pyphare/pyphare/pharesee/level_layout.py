@@ -0,0 +1,123 @@
+
+
+"""
+Diagnostic files written with the "level" layout hold one dataset per quantity and level,
+the data of the patches of the level being concatenated in it:
+
+    /t/<time>/pl<level>/<quantity>           flattened data of all patches of the level
+    /t/<time>/pl<level>/shapes/<quantity>    shape of the data of each patch
+    /t/<time>/pl<level>/patches/<attribute>  attributes of each patch, and its "id"
+
+The classes of this module are read only views of such files presenting the groups of
+the "patch" layout, /t/<time>/pl<level>/p<patch>/<quantity>, so that they are read the same way.
+"""
+
+import numpy as np
+
+
+
+
+def is_level_layout(h5_file):
+    layout = h5_file.attrs.get("layout", "patch")
+    if isinstance(layout, bytes):
+        layout = layout.decode()
+    return layout == "level"
+
+
+
+
+class PatchView:
+    def __init__(self, name, attrs, datasets):
+        self.name = name
+        self.attrs = attrs
+        self.datasets = datasets # name: (level dataset, offset, shape)
+
+    def keys(self):
+        # patch layout files have no datasets for empty patches
+        return [key for key, (_, _, shape) in self.datasets.items() if np.prod(shape) > 0]
+
+    def __getitem__(self, key):
+        dataset, offset, shape = self.datasets[key]
+        return np.asarray(dataset[offset : offset + np.prod(shape)]).reshape(shape)
+
+
+
+
+class LevelView:
+    def __init__(self, h5_level_grp):
+        self.name = h5_level_grp.name
+        self.attrs = h5_level_grp.attrs
+
+        patches = h5_level_grp["patches"]
+        ids = patches["id"][:]
+        attributes = {key : patches[key][:] for key in patches.keys() if key != "id"}
+
+        datasets = {}
+        for key in h5_level_grp.keys():
+            if key in ["patches", "shapes"]:
+                continue
+            shapes = h5_level_grp["shapes"][key][:]
+            offsets = np.concatenate(([0], np.cumsum(np.prod(shapes, axis=1))[:-1]))
+            datasets[key] = (h5_level_grp[key], offsets, shapes)
+
+        self.patches = {}
+        for i, (owner, local) in enumerate(ids):
+            pkey = "p{}#{}".format(owner, local)
+            self.patches[pkey] = PatchView(
+                self.name + "/" + pkey,
+                {key : values[i] for key, values in attributes.items()},
+                {key : (ds, offsets[i], shapes[i]) for key, (ds, offsets, shapes) in datasets.items()})
+
+    def keys(self):
+        return self.patches.keys()
+
+    def __getitem__(self, pkey):
+        return self.patches[pkey]
+
+
+
+
+class TimeView:
+    def __init__(self, h5_time_grp):
+        self.h5_time_grp = h5_time_grp
+        self.levels = {}
+
+    def keys(self):
+        return self.h5_time_grp.keys()
+
+    def __getitem__(self, plvl_key):
+        if plvl_key not in self.levels:
+            self.levels[plvl_key] = LevelView(self.h5_time_grp[plvl_key])
+        return self.levels[plvl_key]
+
+
+
+
+class TimesView:
+    def __init__(self, h5_times_grp):
+        self.h5_times_grp = h5_times_grp
+
+    def keys(self):
+        return self.h5_times_grp.keys()
+
+    def __getitem__(self, time):
+        return TimeView(self.h5_times_grp[time])
+
+
+
+
+class LevelLayoutFile:
+    def __init__(self, h5_file):
+        self.h5_file = h5_file
+        self.attrs = h5_file.attrs
+
+    def keys(self):
+        return self.h5_file.keys()
+
+    def __getitem__(self, key):
+        if key == "t":
+            return TimesView(self.h5_file[key])
+        return self.h5_file[key]
+
+    def close(self):
+        self.h5_file.close()
@@ -48,6 +48,7 @@ if (bench)
 
   add_subdirectory(tools/bench/core/data/particles)
   add_subdirectory(tools/bench/core/numerics/pusher)
+  add_subdirectory(tools/bench/core/numerics/interpolator)
 
   add_subdirectory(tools/bench/hi5)
 
@@ -6,6 +6,19 @@ set (PHARE_PYTHONPATH "${CMAKE_BINARY_DIR}:${CMAKE_SOURCE_DIR}/pyphare")
 
 set (PHARE_BASE_LIBS )
 
+find_package(Threads REQUIRED) # solver patch loops may run on a thread pool
+set (PHARE_BASE_LIBS ${PHARE_BASE_LIBS} Threads::Threads)
+
+if(withSoAParticles) # -DwithSoAParticles=ON
+  add_definitions(-DPHARE_PARTICLES_SOA=1)
+endif(withSoAParticles)
+
+if(particleStreamDelta STREQUAL "float32") # -DparticleStreamDelta=float32
+  add_definitions(-DPHARE_PARTICLE_STREAM_DELTA=1)
+elseif(particleStreamDelta STREQUAL "fixed16") # -DparticleStreamDelta=fixed16
+  add_definitions(-DPHARE_PARTICLE_STREAM_DELTA=2)
+endif()
+
 # Link Time Optimisation flags - is disabled if coverage is enabled
 set (PHARE_INTERPROCEDURAL_OPTIMIZATION FALSE)
 if(withIPO)
@@ -66,6 +66,17 @@ option(withIPO "Use IPO/LTO if system supported" OFF)
 option(withCaliper "Use LLNL Caliper" OFF)
 
 
+# -DwithSoAParticles=OFF
+option(withSoAParticles "Store particles as structure of arrays" OFF)
+# Sets PHARE_PARTICLES_SOA, ParticleArray_t of PHARE_Types is then ContiguousParticles
+
+
+# -DparticleStreamDelta=double
+set(particleStreamDelta "double" CACHE STRING "Encoding of particle deltas in MPI streams")
+set_property(CACHE particleStreamDelta PROPERTY STRINGS double float32 fixed16)
+# float32 and fixed16 send deltas with an error below 2^-24 and 2^-17 of the cell
+
+
 # -DlowResourceTests=ON
 option(lowResourceTests "Disable heavy tests for CI (2d/3d/etc" OFF)
 
@@ -100,6 +111,8 @@ function(print_phare_options)
   message("build with asan support                     : " ${asan})
   message("build with ccache (if found) in devMode     : " ${withCcache})
   message("build with LLNL Caliper                     : " ${withCaliper})
+  message("build with structure of arrays particles    : " ${withSoAParticles})
+  message("encoding of particle deltas in MPI streams  : " ${particleStreamDelta})
 
   if(${devMode})
     message("PHARE_EXEC_LEVEL_MIN                        : " ${PHARE_EXEC_LEVEL_MIN})
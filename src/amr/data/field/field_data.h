@@ -3,7 +3,9 @@
 
 
 #include <SAMRAI/hier/PatchData.h>
+#include <SAMRAI/tbox/Database.h>
 #include <SAMRAI/tbox/MemoryUtilities.h>
+#include <algorithm>
 #include <utility>
 
 #include "core/data/grid/gridlayout.h"
@@ -20,6 +22,27 @@ namespace PHARE
 {
 namespace amr
 {
+    //! how FieldData writes the values it is given: copies overwrite them, sums accumulate them
+    struct SetEqual
+    {
+        template<typename T>
+        void operator()(T& destination, T const& source) const
+        {
+            destination = source;
+        }
+    };
+
+    struct PlusEqual
+    {
+        template<typename T>
+        void operator()(T& destination, T const& source) const
+        {
+            destination += source;
+        }
+    };
+
+
+
     // We use another class here so that we can specialize specifics function: copy , pack , unpack
     // on the dimension and we don't want to loose non specialized function related to SAMRAI
     // interface
@@ -245,46 +268,74 @@ namespace amr
         {
             PHARE_LOG_SCOPE("unpackStream");
 
-            // For unpacking we need to know how much element we will need to
-            // extract
-            std::size_t expectedSize = getDataStreamSize(overlap) / sizeof(double);
+            unpackStream_<SetEqual>(stream, overlap);
+        }
+
+
 
-            std::vector<double> buffer;
-            buffer.resize(expectedSize, 0.);
 
+        /*** \brief Add the source values to the data on the region covered by the overlap,
+         * instead of overwriting them as copy() does.
+         *
+         * Patches sharing nodes each hold their own contribution to the moments there, summing
+         * them gives every patch the total, see FieldBorderSumTransaction
+         */
+        void sum(SAMRAI::hier::PatchData const& source, SAMRAI::hier::BoxOverlap const& overlap)
+        {
+            PHARE_LOG_SCOPE("sum");
+
+            // casts throw on failure
+            auto& fieldSource  = dynamic_cast<FieldData const&>(source);
             auto& fieldOverlap = dynamic_cast<FieldOverlap const&>(overlap);
 
-            // We flush a portion of the stream on the buffer.
-            stream.unpack(buffer.data(), expectedSize);
+            copy_<PlusEqual>(fieldSource, fieldOverlap);
+        }
 
-            SAMRAI::hier::Transformation const& transformation = fieldOverlap.getTransformation();
-            if (transformation.getRotation() == SAMRAI::hier::Transformation::NO_ROTATE)
-            {
-                // Here the seek counter will be used to index buffer
-                std::size_t seek = 0;
 
-                SAMRAI::hier::BoxContainer const& boxContainer
-                    = fieldOverlap.getDestinationBoxContainer();
-                for (auto const& box : boxContainer)
-                {
-                    // For unpackStream, there is no transformation needed, since all the box
-                    // are on the destination space
 
-                    auto& source = field;
-                    SAMRAI::hier::Box destination
-                        = Geometry::toFieldBox(getBox(), quantity_, gridLayout);
 
+        /*** \brief Add the values on the stream to the data on the region covered by the overlap,
+         * the remote counterpart of sum()
+         */
+        void unpackStreamAndSum(SAMRAI::tbox::MessageStream& stream,
+                                SAMRAI::hier::BoxOverlap const& overlap)
+        {
+            PHARE_LOG_SCOPE("unpackStreamAndSum");
 
-                    SAMRAI::hier::Box packBox{box * destination};
+            unpackStream_<PlusEqual>(stream, overlap);
+        }
 
 
-                    internals_.unpackImpl(seek, buffer, source, packBox, destination);
-                }
-            }
+
+        /*** \brief Write the field values, ghost nodes included, to the restart database
+         */
+        void putToRestart(std::shared_ptr<SAMRAI::tbox::Database> const& restart_db) const final
+        {
+            SAMRAI::hier::PatchData::putToRestart(restart_db);
+
+            restart_db->putDoubleArray("field", field.data(), field.size());
         }
 
 
 
+
+        /*** \brief Read the field values written by putToRestart(), the field having been
+         * allocated with the same layout when the patch data was created
+         */
+        void getFromRestart(std::shared_ptr<SAMRAI::tbox::Database> const& restart_db) final
+        {
+            SAMRAI::hier::PatchData::getFromRestart(restart_db);
+
+            auto const values = restart_db->getDoubleVector("field");
+            if (values.size() != field.size())
+                throw std::runtime_error("Error - restarted " + field.name()
+                                         + " does not have the size of the field");
+            std::copy(std::begin(values), std::end(values), std::begin(field));
+        }
+
+
+
+
         FieldImpl* getPointer() { return &field; }
 
 
@@ -326,6 +377,7 @@ namespace amr
         /*** \brief copy data from the intersection box
          *
          */
+        template<typename Operator = SetEqual>
         void copy_(SAMRAI::hier::Box const& intersectBox, SAMRAI::hier::Box const& sourceBox,
                    SAMRAI::hier::Box const& destinationBox,
                    [[maybe_unused]] FieldData const& source, FieldImpl const& fieldSource,
@@ -341,12 +393,14 @@ namespace amr
 
 
             // We can finally perform the copy of the element in the correct range
-            internals_.copyImpl(localSourceBox, fieldSource, localDestinationBox, fieldDestination);
+            internals_.template copyImpl<Operator>(localSourceBox, fieldSource,
+                                                   localDestinationBox, fieldDestination);
         }
 
 
 
 
+        template<typename Operator = SetEqual>
         void copy_(FieldData const& source, FieldOverlap const& overlap)
         {
             // Here the first step is to get the transformation from the overlap
@@ -390,8 +444,9 @@ namespace amr
                             FieldImpl const& sourceField = source.field;
                             FieldImpl& destinationField  = field;
 
-                            copy_(intersectionBox, transformedSource, destinationBox, source,
-                                  sourceField, destinationField);
+                            copy_<Operator>(intersectionBox, transformedSource,
+                                            destinationBox, source, sourceField,
+                                            destinationField);
                         }
                     }
                 }
@@ -403,6 +458,54 @@ namespace amr
         }
 
 
+        /*** \brief Unserialize data contained on the stream and write it with Operator on the
+         * region covered by the overlap
+         */
+        template<typename Operator>
+        void unpackStream_(SAMRAI::tbox::MessageStream& stream,
+                           SAMRAI::hier::BoxOverlap const& overlap)
+        {
+            // For unpacking we need to know how much element we will need to
+            // extract
+            std::size_t expectedSize = getDataStreamSize(overlap) / sizeof(double);
+
+            std::vector<double> buffer;
+            buffer.resize(expectedSize, 0.);
+
+            auto& fieldOverlap = dynamic_cast<FieldOverlap const&>(overlap);
+
+            // We flush a portion of the stream on the buffer.
+            stream.unpack(buffer.data(), expectedSize);
+
+            SAMRAI::hier::Transformation const& transformation = fieldOverlap.getTransformation();
+            if (transformation.getRotation() == SAMRAI::hier::Transformation::NO_ROTATE)
+            {
+                // Here the seek counter will be used to index buffer
+                std::size_t seek = 0;
+
+                SAMRAI::hier::BoxContainer const& boxContainer
+                    = fieldOverlap.getDestinationBoxContainer();
+                for (auto const& box : boxContainer)
+                {
+                    // For unpackStream, there is no transformation needed, since all the box
+                    // are on the destination space
+
+                    auto& source = field;
+                    SAMRAI::hier::Box destination
+                        = Geometry::toFieldBox(getBox(), quantity_, gridLayout);
+
+
+                    SAMRAI::hier::Box packBox{box * destination};
+
+
+                    internals_.template unpackImpl<Operator>(seek, buffer, source, packBox,
+                                                             destination);
+                }
+            }
+        }
+
+
+
         /*** \brief Compute the maximum amount of memory needed to hold FieldData information on
          * the specified overlap, this version work on the source, or the destination
          * depending on withTransform parameter
@@ -442,6 +545,7 @@ namespace amr
     class FieldDataInternals<GridLayoutT, 1, FieldImpl, PhysicalQuantity>
     {
     public:
+        template<typename Operator>
         void copyImpl(SAMRAI::hier::Box const& localSourceBox, FieldImpl const& source,
                       SAMRAI::hier::Box const& localDestinationBox, FieldImpl& destination) const
         {
@@ -457,7 +561,7 @@ namespace amr
                  xSource <= xSourceEnd && xDestination <= xDestinationEnd;
                  ++xSource, ++xDestination)
             {
-                destination(xDestination) = source(xSource);
+                Operator{}(destination(xDestination), source(xSource));
             }
         }
 
@@ -477,6 +581,7 @@ namespace amr
 
 
 
+        template<typename Operator>
         void unpackImpl(std::size_t& seek, std::vector<double> const& buffer, FieldImpl& source,
                         SAMRAI::hier::Box const& overlap,
                         SAMRAI::hier::Box const& destination) const
@@ -486,7 +591,7 @@ namespace amr
 
             for (int xi = xStart; xi <= xEnd; ++xi)
             {
-                source(xi) = buffer[seek];
+                Operator{}(source(xi), buffer[seek]);
                 ++seek;
             }
         }
@@ -499,6 +604,7 @@ namespace amr
     class FieldDataInternals<GridLayoutT, 2, FieldImpl, PhysicalQuantity>
     {
     public:
+        template<typename Operator>
         void copyImpl(SAMRAI::hier::Box const& localSourceBox, FieldImpl const& source,
                       SAMRAI::hier::Box const& localDestinationBox, FieldImpl& destination) const
         {
@@ -526,7 +632,7 @@ namespace amr
                      ySource <= ySourceEnd && yDestination <= yDestinationEnd;
                      ++ySource, ++yDestination)
                 {
-                    destination(xDestination, yDestination) = source(xSource, ySource);
+                    Operator{}(destination(xDestination, yDestination), source(xSource, ySource));
                 }
             }
         }
@@ -556,6 +662,7 @@ namespace amr
 
 
 
+        template<typename Operator>
         void unpackImpl(std::size_t& seek, std::vector<double> const& buffer, FieldImpl& source,
                         SAMRAI::hier::Box const& overlap,
                         SAMRAI::hier::Box const& destination) const
@@ -570,7 +677,7 @@ namespace amr
             {
                 for (int yi = yStart; yi <= yEnd; ++yi)
                 {
-                    source(xi, yi) = buffer[seek];
+                    Operator{}(source(xi, yi), buffer[seek]);
                     ++seek;
                 }
             }
@@ -584,6 +691,7 @@ namespace amr
     class FieldDataInternals<GridLayoutT, 3, FieldImpl, PhysicalQuantity>
     {
     public:
+        template<typename Operator>
         void copyImpl(SAMRAI::hier::Box const& localSourceBox, FieldImpl const& source,
                       SAMRAI::hier::Box const& localDestinationBox, FieldImpl& destination) const
         {
@@ -623,8 +731,8 @@ namespace amr
                          zSource <= zSourceEnd && zDestination <= zDestinationEnd;
                          ++zSource, ++zDestination)
                     {
-                        destination(xDestination, yDestination, zDestination)
-                            = source(xSource, ySource, zSource);
+                        Operator{}(destination(xDestination, yDestination, zDestination),
+                                   source(xSource, ySource, zSource));
                     }
                 }
             }
@@ -660,6 +768,7 @@ namespace amr
 
 
 
+        template<typename Operator>
         void unpackImpl(std::size_t& seek, std::vector<double> const& buffer, FieldImpl& source,
                         SAMRAI::hier::Box const& overlap,
                         SAMRAI::hier::Box const& destination) const
@@ -679,7 +788,7 @@ namespace amr
                 {
                     for (int zi = zStart; zi <= zEnd; ++zi)
                     {
-                        source(xi, yi, zi) = buffer[seek];
+                        Operator{}(source(xi, yi, zi), buffer[seek]);
                         ++seek;
                     }
                 }
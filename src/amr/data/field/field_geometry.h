@@ -54,6 +54,9 @@ public:
 
     auto const& unshared_interiorBox() const { return unshared_interiorBox_; }
 
+    //! field index space box of the patch data, ghost nodes included
+    auto const& ghostBox() const { return ghostBox_; }
+
     std::size_t const dimension;
     SAMRAI::hier::Box const patchBox;
 
@@ -0,0 +1,118 @@
+#ifndef PHARE_SRC_AMR_FIELD_FIELD_SUM_TRANSACTION_H
+#define PHARE_SRC_AMR_FIELD_FIELD_SUM_TRANSACTION_H
+
+#include <SAMRAI/hier/BoxOverlap.h>
+#include <SAMRAI/hier/PatchLevel.h>
+#include <SAMRAI/tbox/MessageStream.h>
+#include <SAMRAI/xfer/RefineCopyTransaction.h>
+#include <SAMRAI/xfer/RefineTransactionFactory.h>
+
+#include <memory>
+
+namespace PHARE::amr
+{
+/*
+  A FieldBorderSumTransaction adds the values of a source FieldData to the destination where the
+  overlap designates, instead of overwriting them. The source is packed as for a copy, only the
+  unpacking and local copies differ, see FieldData::unpackStreamAndSum() and FieldData::sum().
+
+  It is meant for refine schedules of a single level registered with the same patch data as
+  destination and scratch, so that what is summed is never copied over afterwards, and with
+  a FieldBorderSumFillPattern.
+*/
+template<typename FieldData_t>
+class FieldBorderSumTransaction : public SAMRAI::xfer::RefineCopyTransaction
+{
+public:
+    FieldBorderSumTransaction(std::shared_ptr<SAMRAI::hier::PatchLevel> const& dst_level,
+                              std::shared_ptr<SAMRAI::hier::PatchLevel> const& src_level,
+                              std::shared_ptr<SAMRAI::hier::BoxOverlap> const& overlap,
+                              SAMRAI::hier::Box const& dst_box, SAMRAI::hier::Box const& src_box,
+                              SAMRAI::xfer::RefineClasses::Data const** refine_data, int item_id)
+        : SAMRAI::xfer::RefineCopyTransaction(dst_level, src_level, overlap, dst_box, src_box,
+                                              refine_data, item_id)
+        , dst_level_{dst_level}
+        , src_level_{src_level}
+        , overlap_{overlap}
+        , dst_box_{dst_box}
+        , src_box_{src_box}
+        , refine_data_{refine_data}
+        , item_id_{item_id}
+    {
+    }
+
+
+    void unpackStream(SAMRAI::tbox::MessageStream& stream) override
+    {
+        destination_().unpackStreamAndSum(stream, *overlap_);
+    }
+
+
+    void copyLocalData() override
+    {
+        auto const& patch  = src_level_->getPatch(src_box_.getGlobalId());
+        auto const& source = dynamic_cast<FieldData_t const&>(
+            *patch->getPatchData(refine_data_[item_id_]->d_src));
+
+        destination_().sum(source, *overlap_);
+    }
+
+
+private:
+    FieldData_t& destination_() const
+    {
+        auto const& patch = dst_level_->getPatch(dst_box_.getGlobalId());
+        return dynamic_cast<FieldData_t&>(*patch->getPatchData(refine_data_[item_id_]->d_scratch));
+    }
+
+
+    std::shared_ptr<SAMRAI::hier::PatchLevel> dst_level_;
+    std::shared_ptr<SAMRAI::hier::PatchLevel> src_level_;
+    std::shared_ptr<SAMRAI::hier::BoxOverlap> overlap_;
+    SAMRAI::hier::Box const dst_box_;
+    SAMRAI::hier::Box const src_box_;
+    SAMRAI::xfer::RefineClasses::Data const** refine_data_;
+    int const item_id_;
+};
+
+
+
+
+/*
+  Given to RefineAlgorithm::createSchedule() so that the transactions of the schedule are
+  FieldBorderSumTransactions, see RefinerType::PatchFieldBorderSum
+*/
+template<typename FieldData_t>
+class FieldBorderSumTransactionFactory : public SAMRAI::xfer::RefineTransactionFactory
+{
+public:
+    std::shared_ptr<SAMRAI::tbox::Transaction>
+    allocate(std::shared_ptr<SAMRAI::hier::PatchLevel> const& dst_level,
+             std::shared_ptr<SAMRAI::hier::PatchLevel> const& src_level,
+             std::shared_ptr<SAMRAI::hier::BoxOverlap> const& overlap,
+             SAMRAI::hier::Box const& dst_box, SAMRAI::hier::Box const& src_box,
+             SAMRAI::xfer::RefineClasses::Data const** refine_data, int item_id,
+             [[maybe_unused]] SAMRAI::hier::Box const& box,
+             [[maybe_unused]] bool use_time_interpolation) const override
+    {
+        return std::make_shared<FieldBorderSumTransaction<FieldData_t>>(
+            dst_level, src_level, overlap, dst_box, src_box, refine_data, item_id);
+    }
+
+
+    std::shared_ptr<SAMRAI::tbox::Transaction>
+    allocate(std::shared_ptr<SAMRAI::hier::PatchLevel> const& dst_level,
+             std::shared_ptr<SAMRAI::hier::PatchLevel> const& src_level,
+             std::shared_ptr<SAMRAI::hier::BoxOverlap> const& overlap,
+             SAMRAI::hier::Box const& dst_box, SAMRAI::hier::Box const& src_box,
+             SAMRAI::xfer::RefineClasses::Data const** refine_data, int item_id,
+             bool use_time_interpolation) const
+    {
+        return allocate(dst_level, src_level, overlap, dst_box, src_box, refine_data, item_id,
+                        SAMRAI::hier::Box{dst_level->getDim()}, use_time_interpolation);
+    }
+};
+
+} // namespace PHARE::amr
+
+#endif
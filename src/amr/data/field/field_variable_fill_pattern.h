@@ -146,6 +146,54 @@ private:
     std::optional<bool> opt_overwrite_interior_{nullptr};
 };
 
+
+
+/*
+  This class is used by the schedules summing the values that neighbor patches hold on the nodes
+  they share, see field_sum_transaction.h. Each patch deposits the moments of its own particles on
+  its domain and ghost nodes, so every node lying in the ghost boxes of both patches is summed.
+  A patch is not summed with itself, only with its periodic images.
+*/
+class FieldBorderSumFillPattern : public FieldFillPattern
+{
+public:
+    FieldBorderSumFillPattern()
+        : FieldFillPattern{std::nullopt}
+    {
+    }
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap>
+    calculateOverlap(SAMRAI::hier::BoxGeometry const& dst_geometry,
+                     SAMRAI::hier::BoxGeometry const& src_geometry,
+                     [[maybe_unused]] SAMRAI::hier::Box const& dst_patch_box,
+                     [[maybe_unused]] SAMRAI::hier::Box const& src_mask,
+                     [[maybe_unused]] SAMRAI::hier::Box const& fill_box,
+                     [[maybe_unused]] bool const fn_overwrite_interior,
+                     SAMRAI::hier::Transformation const& transformation) const override
+    {
+        auto& dst_cast = dynamic_cast<AFieldGeometry const&>(dst_geometry);
+        auto& src_cast = dynamic_cast<AFieldGeometry const&>(src_geometry);
+
+        SAMRAI::hier::BoxContainer destinationBoxes;
+
+        auto const& offset = transformation.getOffset();
+        bool const itself  = src_cast.patchBox.getGlobalId() == dst_cast.patchBox.getGlobalId()
+                            and offset == SAMRAI::hier::IntVector::getZero(offset.getDim());
+
+        if (!itself)
+        {
+            SAMRAI::hier::Box sourceGhostBox{src_cast.ghostBox()};
+            transformation.transform(sourceGhostBox);
+
+            SAMRAI::hier::Box const shared{dst_cast.ghostBox() * sourceGhostBox};
+            if (!shared.empty())
+                destinationBoxes.push_back(shared);
+        }
+
+        return std::make_shared<FieldOverlap>(destinationBoxes, transformation);
+    }
+};
+
 } // namespace PHARE::amr
 
 #endif /* PHARE_SRC_AMR_FIELD_FIELD_VARIABLE_FILL_PATTERN_H */
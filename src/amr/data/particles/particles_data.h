@@ -3,17 +3,22 @@
 
 #include <numeric>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <SAMRAI/hier/BoxOverlap.h>
 #include <SAMRAI/hier/IntVector.h>
 #include <SAMRAI/hier/PatchData.h>
 #include <SAMRAI/pdat/CellOverlap.h>
+#include <SAMRAI/tbox/Database.h>
 #include <SAMRAI/tbox/MemoryUtilities.h>
 
 
 #include "core/data/ions/ion_population/particle_pack.h"
 #include "core/data/particles/particle.h"
 #include "core/data/particles/particle_array.h"
+#include "core/data/particles/particle_cell_index.h"
+#include "core/data/particles/particle_wire_format.h"
 #include "amr/resources_manager/amr_utils.h"
 
 #include "core/logger.h"
@@ -243,11 +248,18 @@ namespace amr
 
 
 
+        /**
+         * @brief getDataStreamSize returns the exact number of bytes packStream packs for the
+         * given overlap, so that the stream never has to grow.
+         */
         std::size_t getDataStreamSize(SAMRAI::hier::BoxOverlap const& overlap) const override
         {
             auto const& pOverlap{dynamic_cast<SAMRAI::pdat::CellOverlap const&>(overlap)};
 
-            return countNumberParticlesIn_(pOverlap) * sizeof(Particle_t);
+            if (pOverlap.isOverlapEmpty())
+                return 0;
+
+            return wireFormat_(pOverlap).size(countNumberParticlesIn_(pOverlap));
         }
 
 
@@ -268,6 +280,9 @@ namespace amr
          *
          * Note that step 2 could be done upon reception of the pack, we chose to do it before.
          *
+         * Particles are packed in the ParticleWireFormat, with iCell relative to the bounding
+         * box of the overlap boxes, which unpackStream gets as well. Nothing is packed for an
+         * empty overlap.
          */
         void packStream(SAMRAI::tbox::MessageStream& stream,
                         SAMRAI::hier::BoxOverlap const& overlap) const override
@@ -276,51 +291,15 @@ namespace amr
 
             auto const& pOverlap{dynamic_cast<SAMRAI::pdat::CellOverlap const&>(overlap)};
 
-            std::vector<Particle_t> specie;
-
             if (pOverlap.isOverlapEmpty())
-            {
-                constexpr std::size_t zero = 0;
-                stream << zero;
-            }
-            else
-            {
-                SAMRAI::hier::Transformation const& transformation = pOverlap.getTransformation();
-                if (transformation.getRotation() == SAMRAI::hier::Transformation::NO_ROTATE)
-                {
-                    SAMRAI::hier::BoxContainer const& boxContainer
-                        = pOverlap.getDestinationBoxContainer();
+                return;
 
-                    auto const& sourceGhostBox = getGhostBox();
-
-                    // sourceBox + offset = source on destination
-                    // we are given boxes in the Overlap in destination
-                    // index space. And we want to select all particles
-                    // in the ghost source box that lie in this overlapBox
-                    // we thus need to first shift the sourceGhostBox to the
-                    // destination index space so that its cells (partly) overlap the one
-                    // of the given overlap boxes.
-                    // Then pack_ will take all particles which iCell, shifted by the
-                    // transformation offset onto the overlapBox index space,
-                    // lie in the overlap box.
-                    SAMRAI::hier::Box transformedSource{sourceGhostBox};
-                    transformation.transform(transformedSource);
-
-                    for (auto const& overlapBox : boxContainer)
-                    {
-                        SAMRAI::hier::Box intersectionBox{transformedSource * overlapBox};
+            std::vector<Particle_t> outBuffer;
+            visitStreamedParticles_(pOverlap, [&](Particle_t const& particle) { //
+                outBuffer.push_back(particle);
+            });
 
-                        pack_(specie, intersectionBox, sourceGhostBox, transformation);
-                    }
-                }
-                else
-                {
-                    throw std::runtime_error("Error - rotations not handled in PHARE");
-                }
-                stream << specie.size();
-                stream.growBufferAsNeeded();
-                stream.pack(specie.data(), specie.size());
-            }
+            wireFormat_(pOverlap).write(stream, outBuffer);
         }
 
 
@@ -348,10 +327,7 @@ namespace amr
             if (!pOverlap.isOverlapEmpty())
             {
                 // unpack particles into a particle array
-                std::size_t numberParticles = 0;
-                stream >> numberParticles;
-                std::vector<Particle_t> particleArray(numberParticles);
-                stream.unpack(particleArray.data(), numberParticles);
+                auto const particleArray = wireFormat_(pOverlap).read(stream);
 
                 // ok now our goal is to put the particles we have just unpacked
                 // into the particleData and in the proper particleArray : interior or ghost
@@ -398,6 +374,58 @@ namespace amr
 
 
 
+        /**
+         * @brief putToRestart writes all particle arrays to the restart database, one vector per
+         * particle attribute, so that a restarted patch holds exactly the same particles.
+         */
+        void putToRestart(std::shared_ptr<SAMRAI::tbox::Database> const& restart_db) const override
+        {
+            SAMRAI::hier::PatchData::putToRestart(restart_db);
+
+            putParticles_(*restart_db, "domainParticles", domainParticles);
+            putParticles_(*restart_db, "patchGhostParticles", patchGhostParticles);
+            putParticles_(*restart_db, "levelGhostParticles", levelGhostParticles);
+            putParticles_(*restart_db, "levelGhostParticlesOld", levelGhostParticlesOld);
+            putParticles_(*restart_db, "levelGhostParticlesNew", levelGhostParticlesNew);
+        }
+
+
+
+
+        void getFromRestart(std::shared_ptr<SAMRAI::tbox::Database> const& restart_db) override
+        {
+            SAMRAI::hier::PatchData::getFromRestart(restart_db);
+
+            getParticles_(*restart_db, "domainParticles", domainParticles);
+            getParticles_(*restart_db, "patchGhostParticles", patchGhostParticles);
+            getParticles_(*restart_db, "levelGhostParticles", levelGhostParticles);
+            getParticles_(*restart_db, "levelGhostParticlesOld", levelGhostParticlesOld);
+            getParticles_(*restart_db, "levelGhostParticlesNew", levelGhostParticlesNew);
+            dropCellIndex();
+        }
+
+
+
+
+        /**
+         * @brief indexCells bins the domain particles by cell of the ghost box, so that copies
+         * and streams read only the domain particles of the cells of their overlap boxes.
+         *
+         * The index is used until dropCellIndex() is called. Domain particles must not be modified
+         * in between, other than by this ParticlesData, so it is meant to be built just before a
+         * schedule is executed and dropped after.
+         */
+        void indexCells()
+        {
+            domainCellIndex_.build(domainParticles, toCellBox_(getGhostBox()));
+            cellIndexed_ = true;
+        }
+
+        void dropCellIndex() { cellIndexed_ = false; }
+
+
+
+
         core::ParticlesPack<ParticleArray>* getPointer() { return &pack; }
 
 
@@ -423,15 +451,123 @@ namespace amr
         //! end index"
         SAMRAI::hier::Box interiorLocalBox_;
 
+        core::ParticleCellIndex<dim> domainCellIndex_;
+        bool cellIndexed_ = false;
+
+
+
+        static core::Box<int, dim> toCellBox_(SAMRAI::hier::Box const& box)
+        {
+            core::Box<int, dim> cells;
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                cells.lower[iDim] = box.lower(iDim);
+                cells.upper[iDim] = box.upper(iDim);
+            }
+            return cells;
+        }
+
+
+        /**
+         * @brief visitDomainParticles_ calls fn on the domain particles that may lie in box, all
+         * of them unless cells are indexed. fn still has to check particles are in the box.
+         */
+        template<typename Fn>
+        void visitDomainParticles_(SAMRAI::hier::Box const& box, Fn&& fn) const
+        {
+            std::size_t firstNotIndexed = 0;
+            if (cellIndexed_)
+            {
+                if (!box.empty())
+                    domainCellIndex_.visit(toCellBox_(box), [&](std::size_t iPart) {
+                        fn(domainParticles[iPart]);
+                    });
+                firstNotIndexed = domainCellIndex_.size(); // appended since indexCells()
+            }
+
+            auto const nbrParticles = domainParticles.size();
+            for (auto iPart = firstNotIndexed; iPart < nbrParticles; ++iPart)
+                fn(domainParticles[iPart]);
+        }
+
+
+
+        static void putParticles_(SAMRAI::tbox::Database& db, std::string const& name,
+                                  ParticleArray const& particles)
+        {
+            auto const nbrParticles = particles.size();
+            db.putInteger(name + "_size", static_cast<int>(nbrParticles));
+
+            // empty arrays are not written, not all databases can hold them
+            if (nbrParticles == 0)
+                return;
+
+            std::vector<double> weight, charge, delta, v;
+            std::vector<int> iCell;
+            weight.reserve(nbrParticles);
+            charge.reserve(nbrParticles);
+            iCell.reserve(nbrParticles * dim);
+            delta.reserve(nbrParticles * dim);
+            v.reserve(nbrParticles * 3);
+
+            for (auto const& particle : particles)
+            {
+                weight.push_back(particle.weight);
+                charge.push_back(particle.charge);
+                iCell.insert(std::end(iCell), std::begin(particle.iCell), std::end(particle.iCell));
+                delta.insert(std::end(delta), std::begin(particle.delta), std::end(particle.delta));
+                v.insert(std::end(v), std::begin(particle.v), std::end(particle.v));
+            }
+
+            db.putDoubleVector(name + "_weight", weight);
+            db.putDoubleVector(name + "_charge", charge);
+            db.putIntegerVector(name + "_iCell", iCell);
+            db.putDoubleVector(name + "_delta", delta);
+            db.putDoubleVector(name + "_v", v);
+        }
+
+
+
+
+        static void getParticles_(SAMRAI::tbox::Database& db, std::string const& name,
+                                  ParticleArray& particles)
+        {
+            auto const nbrParticles = static_cast<std::size_t>(db.getInteger(name + "_size"));
+
+            particles.clear();
+            if (nbrParticles == 0)
+                return;
+
+            auto const weight = db.getDoubleVector(name + "_weight");
+            auto const charge = db.getDoubleVector(name + "_charge");
+            auto const iCell  = db.getIntegerVector(name + "_iCell");
+            auto const delta  = db.getDoubleVector(name + "_delta");
+            auto const v      = db.getDoubleVector(name + "_v");
+
+            particles.reserve(nbrParticles);
+            for (std::size_t iPart = 0; iPart < nbrParticles; ++iPart)
+            {
+                Particle_t particle;
+                particle.weight = weight[iPart];
+                particle.charge = charge[iPart];
+                for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                {
+                    particle.iCell[iDim] = iCell[iPart * dim + iDim];
+                    particle.delta[iDim] = delta[iPart * dim + iDim];
+                }
+                for (std::size_t iV = 0; iV < 3; ++iV)
+                    particle.v[iV] = v[iPart * 3 + iV];
+                particles.push_back(particle);
+            }
+        }
+
+
 
 
         void copy_([[maybe_unused]] SAMRAI::hier::Box const& sourceGhostBox,
                    [[maybe_unused]] SAMRAI::hier::Box const& destinationGhostBox,
                    SAMRAI::hier::Box const& intersectionBox, ParticlesData const& sourceData)
         {
-            std::array<decltype(sourceData.domainParticles) const*, 2> particlesArrays{
-                &sourceData.domainParticles, &sourceData.patchGhostParticles};
-
             auto myDomainBox = this->getBox();
 
             // for each particles in the source ghost and domain particle arrays
@@ -439,23 +575,23 @@ namespace amr
             // if it is, is it in my domain box ?
             //      - if so, let's add it to my domain particle array
             //      - if not, let's add it to my ghost particle array
-            for (auto const& sourceParticlesArray : particlesArrays)
-            {
-                for (auto const& particle : *sourceParticlesArray)
+            auto copyParticle = [&](auto const& particle) {
+                if (isInBox(intersectionBox, particle))
                 {
-                    if (isInBox(intersectionBox, particle))
+                    if (isInBox(myDomainBox, particle))
                     {
-                        if (isInBox(myDomainBox, particle))
-                        {
-                            domainParticles.push_back(particle);
-                        }
-                        else
-                        {
-                            patchGhostParticles.push_back(particle);
-                        }
+                        domainParticles.push_back(particle);
+                    }
+                    else
+                    {
+                        patchGhostParticles.push_back(particle);
                     }
                 }
-            }
+            };
+
+            sourceData.visitDomainParticles_(intersectionBox, copyParticle);
+            for (auto const& particle : sourceData.patchGhostParticles)
+                copyParticle(particle);
         }
 
 
@@ -466,44 +602,45 @@ namespace amr
                                 SAMRAI::hier::Transformation const& transformation,
                                 ParticlesData const& sourceData)
         {
-            std::array<decltype(sourceData.domainParticles) const*, 2> particlesArrays{
-                &sourceData.domainParticles, &sourceData.patchGhostParticles};
-
             auto myDomainBox = this->getBox();
 
             auto offset = transformation.getOffset();
 
-            for (auto const& sourceParticlesArray : particlesArrays)
-            {
-                for (auto const& particle : *sourceParticlesArray)
+            auto copyParticle = [&](auto const& particle) {
+                // the particle is only copied if it is in the intersectionBox
+                // but before its iCell must be shifted by the transformation offset
+
+                Particle_t newParticle = particle; // copy, particle may be a view
+                for (auto iDir = 0u; iDir < newParticle.iCell.size(); ++iDir)
                 {
-                    // the particle is only copied if it is in the intersectionBox
-                    // but before its iCell must be shifted by the transformation offset
+                    newParticle.iCell[iDir] += offset[iDir];
+                }
+
+                if (isInBox(intersectionBox, newParticle))
+                {
+                    // now we now the particle is in the intersection
+                    // we need to know whether it is in the domain part of that
+                    // intersection. If it is not, then it must be in the ghost part
 
-                    auto newParticle{particle};
-                    for (auto iDir = 0u; iDir < newParticle.iCell.size(); ++iDir)
+
+                    if (isInBox(myDomainBox, newParticle))
                     {
-                        newParticle.iCell[iDir] += offset[iDir];
+                        domainParticles.push_back(newParticle);
                     }
-
-                    if (isInBox(intersectionBox, newParticle))
+                    else
                     {
-                        // now we now the particle is in the intersection
-                        // we need to know whether it is in the domain part of that
-                        // intersection. If it is not, then it must be in the ghost part
-
-
-                        if (isInBox(myDomainBox, newParticle))
-                        {
-                            domainParticles.push_back(newParticle);
-                        }
-                        else
-                        {
-                            patchGhostParticles.push_back(newParticle);
-                        }
+                        patchGhostParticles.push_back(newParticle);
                     }
                 }
-            }
+            };
+
+            // the intersectionBox is shifted back on top of source AMR indexes
+            SAMRAI::hier::Box sourceIntersectionBox{intersectionBox};
+            transformation.inverseTransform(sourceIntersectionBox);
+
+            sourceData.visitDomainParticles_(sourceIntersectionBox, copyParticle);
+            for (auto const& particle : sourceData.patchGhostParticles)
+                copyParticle(particle);
 
 
             // SAMRAI::hier::Box localSourceSelectionBox = AMRToLocal(intersectionBox,
@@ -521,8 +658,7 @@ namespace amr
         /**
          * @brief countNumberParticlesIn_ counts the number of particles that lie
          * within the boxes of an overlap. This function count both patchGhost and
-         * domain particles since both could be streamed and we want an upperbound
-         * on the number of bytes that could be streamed.
+         * domain particles since both are streamed, packStream packs exactly these.
          */
         std::size_t countNumberParticlesIn_(SAMRAI::pdat::CellOverlap const& overlap) const
         {
@@ -533,77 +669,80 @@ namespace amr
                 return numberParticles;
             }
 
-            auto const& overlapBoxes = overlap.getDestinationBoxContainer();
+            visitStreamedParticles_(overlap, [&](Particle_t const&) { ++numberParticles; });
 
-            for (auto const& overlapBox : overlapBoxes)
-            {
-                // we are given boxes from the overlap
-                // we want to know how many of our local particles
-                // lie in that overlap. Overlap is given in the destination
-                // index space (see overlap documentation)
-                // so we need to transform that overlap box into our box index space.
-                // Since source index space + offset = destination indexspace
-                // we need to apply an inverseTransform to the overlapBox.
-                // then we intersect it with our Box and count how many of domain particles
-                // our inside that intersection.
-                SAMRAI::hier::Box shiftedOverlapBox{overlapBox};
-                SAMRAI::hier::Transformation const& transformation = overlap.getTransformation();
-                transformation.inverseTransform(shiftedOverlapBox);
-                SAMRAI::hier::Box intersectionBox{shiftedOverlapBox * getGhostBox()};
-
-                numberParticles += countNumberParticlesIn_(intersectionBox);
-            }
             return numberParticles;
         }
 
 
         /**
-         * @brief countNumberParticlesIn_ returns the number of interior particles within a given
-         * box
+         * @brief visitStreamedParticles_ calls fn on the domain and patchGhost particles
+         * streamed for the given overlap, shifted to the destination index space.
          *
-         * the box given is in AMR index space so the function first needs to put it in
-         * local indexing relative to the domain box
+         * overlap boxes are given in the destination index space. We want to select all
+         * particles in the ghost source box that lie in these overlap boxes. We thus need to
+         * first shift the sourceGhostBox to the destination index space so that its cells
+         * (partly) overlap the ones of the overlap boxes. Then pack_ takes all particles which
+         * iCell, shifted by the transformation offset, lie in the intersection.
          */
-        std::size_t countNumberParticlesIn_(SAMRAI::hier::Box const& box) const
+        template<typename Fn>
+        void visitStreamedParticles_(SAMRAI::pdat::CellOverlap const& overlap, Fn&& fn) const
         {
-            std::size_t numberParticles{0};
-
-            for (auto const& particle : domainParticles)
+            SAMRAI::hier::Transformation const& transformation = overlap.getTransformation();
+            if (transformation.getRotation() != SAMRAI::hier::Transformation::NO_ROTATE)
             {
-                if (isInBox(box, particle))
-                {
-                    ++numberParticles;
-                }
+                throw std::runtime_error("Error - rotations not handled in PHARE");
             }
-            return numberParticles;
-        }
 
+            // sourceBox + offset = source on destination
+            SAMRAI::hier::Box transformedSource{getGhostBox()};
+            transformation.transform(transformedSource);
 
+            for (auto const& overlapBox : overlap.getDestinationBoxContainer())
+            {
+                SAMRAI::hier::Box intersectionBox{transformedSource * overlapBox};
+
+                pack_(intersectionBox, transformation, fn);
+            }
+        }
 
 
-        void pack_(std::vector<Particle_t>& buffer, SAMRAI::hier::Box const& intersectionBox,
-                   [[maybe_unused]] SAMRAI::hier::Box const& sourceBox,
-                   SAMRAI::hier::Transformation const& transformation) const
+        template<typename Fn>
+        void pack_(SAMRAI::hier::Box const& intersectionBox,
+                   SAMRAI::hier::Transformation const& transformation, Fn& fn) const
         {
-            std::array<decltype(domainParticles) const*, 2> particlesArrays{&domainParticles,
-                                                                            &patchGhostParticles};
+            auto offset = transformation.getOffset();
 
-            for (auto const& sourceParticlesArray : particlesArrays)
-            {
-                for (auto const& particle : *sourceParticlesArray)
+            auto packParticle = [&](auto const& particle) {
+                Particle_t shiftedParticle = particle;
+                for (auto i = 0u; i < dim; ++i)
                 {
-                    auto shiftedParticle{particle};
-                    auto offset = transformation.getOffset();
-                    for (auto i = 0u; i < dim; ++i)
-                    {
-                        shiftedParticle.iCell[i] += offset[i];
-                    }
-                    if (isInBox(intersectionBox, shiftedParticle))
-                    {
-                        buffer.push_back(shiftedParticle);
-                    }
+                    shiftedParticle.iCell[i] += offset[i];
                 }
-            }
+                if (isInBox(intersectionBox, shiftedParticle))
+                {
+                    fn(shiftedParticle);
+                }
+            };
+
+            // the intersectionBox is in destination index space, our particles are not
+            SAMRAI::hier::Box sourceIntersectionBox{intersectionBox};
+            transformation.inverseTransform(sourceIntersectionBox);
+
+            visitDomainParticles_(sourceIntersectionBox, packParticle);
+            for (auto const& particle : patchGhostParticles)
+                packParticle(particle);
+        }
+
+
+        /**
+         * @brief wireFormat_ returns the encoding of the particles streamed for the given
+         * overlap, which both ends of the stream build from the destination boxes.
+         */
+        static core::ParticleWireFormat<dim> wireFormat_(SAMRAI::pdat::CellOverlap const& overlap)
+        {
+            return core::ParticleWireFormat<dim>{
+                toCellBox_(overlap.getDestinationBoxContainer().getBoundingBox())};
         }
     };
 } // namespace amr
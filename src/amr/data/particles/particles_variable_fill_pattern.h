@@ -0,0 +1,62 @@
+#ifndef PHARE_SRC_AMR_PARTICLES_PARTICLES_VARIABLE_FILL_PATTERN_H
+#define PHARE_SRC_AMR_PARTICLES_PARTICLES_VARIABLE_FILL_PATTERN_H
+
+#include <memory>
+
+#include <SAMRAI/hier/Box.h>
+#include <SAMRAI/hier/BoxContainer.h>
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/pdat/CellOverlap.h>
+#include "SAMRAI/xfer/BoxGeometryVariableFillPattern.h"
+
+
+namespace PHARE::amr
+{
+/*
+  This class is used by the schedules filling the patch ghost particles when their moments are not
+  deposited, i.e. when the moments neighbor patches deposit on shared nodes are summed instead, see
+  HybridHybridMessengerStrategy::patchGhostParticles_.
+  Patch ghost particles are then only needed for those entering the patch during the next push.
+  Since a particle crosses less than a cell per time step, only the particles of the cells within
+  bandWidth cells of the destination patch box are exchanged, rather than those of the whole
+  particle ghost box.
+*/
+class ParticlesGhostBandFillPattern : public SAMRAI::xfer::BoxGeometryVariableFillPattern
+{
+public:
+    explicit ParticlesGhostBandFillPattern(int const bandWidth = 1)
+        : bandWidth_{bandWidth}
+    {
+    }
+
+    virtual ~ParticlesGhostBandFillPattern() {}
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap>
+    calculateOverlap(SAMRAI::hier::BoxGeometry const& dst_geometry,
+                     SAMRAI::hier::BoxGeometry const& src_geometry,
+                     SAMRAI::hier::Box const& dst_patch_box, SAMRAI::hier::Box const& src_mask,
+                     SAMRAI::hier::Box const& fill_box, bool const overwrite_interior,
+                     SAMRAI::hier::Transformation const& transformation) const override
+    {
+        auto ghostOverlap = BoxGeometryVariableFillPattern::calculateOverlap(
+            dst_geometry, src_geometry, dst_patch_box, src_mask, fill_box, overwrite_interior,
+            transformation);
+        auto& overlap = dynamic_cast<SAMRAI::pdat::CellOverlap const&>(*ghostOverlap);
+
+        SAMRAI::hier::Box band{dst_patch_box};
+        band.grow(SAMRAI::hier::IntVector{dst_patch_box.getDim(), bandWidth_});
+
+        SAMRAI::hier::BoxContainer destinationBoxes{overlap.getDestinationBoxContainer()};
+        destinationBoxes.intersectBoxes(band);
+
+        return std::make_shared<SAMRAI::pdat::CellOverlap>(destinationBoxes,
+                                                           overlap.getTransformation());
+    }
+
+private:
+    int const bandWidth_;
+};
+
+} // namespace PHARE::amr
+
+#endif /* PHARE_SRC_AMR_PARTICLES_PARTICLES_VARIABLE_FILL_PATTERN_H */
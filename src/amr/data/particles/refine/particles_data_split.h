@@ -30,11 +30,14 @@ namespace amr
 
 
     template<std::size_t interp, typename Particle>
-    Particle toFineGrid(Particle toFine)
+    auto toFineGrid(Particle const& particle)
     {
         constexpr auto dim   = Particle::dimension;
         constexpr auto ratio = PHARE::amr::refinementRatio;
 
+        // particle may be a view on a contiguous array, work on a copy
+        core::Particle<dim> toFine = particle;
+
         for (size_t iDim = 0; iDim < dim; ++iDim)
         {
             auto fineDelta     = toFine.delta[iDim] * ratio;
@@ -62,7 +62,12 @@ namespace solver
 
             if (isRootLevel(levelNumber))
             {
-                model.initialize(level);
+                // the root level is regridded when its patches are redistributed among ranks,
+                // its data then come from the old level rather than from the initial conditions
+                if (isRegridding)
+                    messenger.regrid(hierarchy, levelNumber, oldLevel, model, initDataTime);
+                else
+                    model.initialize(level);
                 messenger.fillRootGhosts(model, level, initDataTime);
             }
 
@@ -81,18 +86,24 @@ namespace solver
 
             // now all particles are here
 
+            auto& ions             = hybridModel.state.ions;
+            auto& resourcesManager = hybridModel.resourcesManager;
+
             for (auto& patch : level)
             {
-                auto& ions             = hybridModel.state.ions;
-                auto& resourcesManager = hybridModel.resourcesManager;
-                auto dataOnPatch       = resourcesManager->setOnPatch(*patch, ions);
-                auto layout            = amr::layoutFromPatch<GridLayoutT>(*patch);
-
+                auto dataOnPatch = resourcesManager->setOnPatch(*patch, ions);
+                auto layout      = amr::layoutFromPatch<GridLayoutT>(*patch);
 
                 core::resetMoments(ions);
                 core::depositParticles(ions, layout, interpolate_, core::DomainDeposit{});
-                core::depositParticles(ions, layout, interpolate_, core::PatchGhostDeposit{});
+            }
 
+            hybMessenger.fillIonPatchGhostMoments(ions, level, initDataTime);
+
+            for (auto& patch : level)
+            {
+                auto dataOnPatch = resourcesManager->setOnPatch(*patch, ions);
+                auto layout      = amr::layoutFromPatch<GridLayoutT>(*patch);
 
                 if (!isRootLevel(levelNumber))
                 {
@@ -117,11 +128,17 @@ namespace solver
                     auto __     = core::SetLayout(&layout, ampere_);
                     ampere_(B, J);
 
-                    hybridModel.resourcesManager->setTime(J, *patch, 0.);
+                    hybridModel.resourcesManager->setTime(J, *patch, initDataTime);
                 }
-                hybMessenger.fillCurrentGhosts(J, levelNumber, 0.);
+                hybMessenger.fillCurrentGhosts(J, levelNumber, initDataTime);
+            }
 
 
+            // a regridded root level already has the electric field of the old level
+            if (isRootLevel(levelNumber) and !isRegridding)
+            {
+                auto& B = hybridModel.state.electromag.B;
+                auto& J = hybridModel.state.J;
 
                 auto& electrons = hybridModel.state.electrons;
                 auto& E         = hybridModel.state.electromag.E;
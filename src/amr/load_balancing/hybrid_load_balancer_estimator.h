@@ -0,0 +1,85 @@
+#ifndef PHARE_HYBRID_LOAD_BALANCER_ESTIMATOR_H
+#define PHARE_HYBRID_LOAD_BALANCER_ESTIMATOR_H
+
+#include "load_balancer_estimator.h"
+#include "amr/physical_models/hybrid_model.h"
+#include "amr/types/amr_types.h"
+#include "core/utilities/box/cell_indexer.h"
+
+#include <SAMRAI/pdat/CellData.h>
+
+#include <memory>
+
+
+
+
+namespace PHARE::amr
+{
+/** HybridLoadBalancerEstimator estimates the cost of a cell as the number of domain particles
+ * of all populations in that cell, to which is added a constant fieldWeight accounting for the
+ * field solve, in units of the cost of pushing one particle.
+ */
+template<typename HybridModel>
+class HybridLoadBalancerEstimator : public LoadBalancerEstimator
+{
+    using amr_t          = PHARE::amr::SAMRAI_Types;
+    using level_t        = typename amr_t::level_t;
+    using IPhysicalModel = PHARE::solver::IPhysicalModel<amr_t>;
+
+    static constexpr auto dimension = HybridModel::dimension;
+
+public:
+    explicit HybridLoadBalancerEstimator(double fieldWeight)
+        : LoadBalancerEstimator{"HybridLoadBalancerEstimator", dimension}
+        , fieldWeight_{fieldWeight}
+    {
+    }
+
+    void estimate(level_t& level, IPhysicalModel& model) override;
+
+private:
+    double fieldWeight_;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+//                           Definitions
+//-----------------------------------------------------------------------------
+
+
+
+
+template<typename HybridModel>
+void HybridLoadBalancerEstimator<HybridModel>::estimate(level_t& level, IPhysicalModel& model)
+{
+    auto& hybridModel = dynamic_cast<HybridModel&>(model);
+
+    for (auto& patch : level)
+    {
+        auto modelIsOnPatch = hybridModel.setOnPatch(*patch);
+        auto pd             = dynamic_cast<SAMRAI::pdat::CellData<double>*>(
+            patch->getPatchData(workloadId()).get());
+        pd->fill(fieldWeight_);
+
+        // SAMRAI cell data are stored with the first direction varying fastest
+        auto const& ghostBox = pd->getGhostBox();
+        core::Box<int, dimension> box;
+        for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+        {
+            box.lower[iDim] = ghostBox.lower(iDim);
+            box.upper[iDim] = ghostBox.upper(iDim);
+        }
+        core::CellIndexer<dimension, true> cellIndex{box};
+        auto workload = pd->getPointer();
+
+        for (auto& pop : hybridModel.state.ions)
+            for (auto const& particle : pop.domainParticles())
+                workload[cellIndex(particle.iCell)] += 1.;
+    }
+}
+
+} // namespace PHARE::amr
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef PHARE_LOAD_BALANCER_ESTIMATOR_H
+#define PHARE_LOAD_BALANCER_ESTIMATOR_H
+
+#include "amr/physical_models/physical_model.h"
+#include "amr/types/amr_types.h"
+
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/hier/PatchLevel.h>
+#include <SAMRAI/hier/VariableDatabase.h>
+#include <SAMRAI/pdat/CellVariable.h>
+#include <SAMRAI/tbox/Dimension.h>
+
+#include <memory>
+#include <string>
+
+namespace PHARE::amr
+{
+/** LoadBalancerEstimator fills, on each patch of a level, a cell centered workload that
+ * the SAMRAI load balancer uses instead of the number of cells to distribute patches.
+ *
+ * The workload variable is registered to the SAMRAI VariableDatabase at construction, and
+ * workloadId() is to be given to the load balancer. Models define the cost of a cell by
+ * implementing estimate().
+ */
+class LoadBalancerEstimator
+{
+protected:
+    using amr_t   = PHARE::amr::SAMRAI_Types;
+    using level_t = PHARE::amr::SAMRAI_Types::level_t;
+    std::string name_;
+
+public:
+    LoadBalancerEstimator(std::string name, std::size_t dimension)
+        : name_{name}
+        , workload_{std::make_shared<SAMRAI::pdat::CellVariable<double>>(
+              SAMRAI::tbox::Dimension{static_cast<unsigned short>(dimension)}, "workload")}
+    {
+        auto* variableDatabase = SAMRAI::hier::VariableDatabase::getDatabase();
+        workloadId_            = variableDatabase->registerVariableAndContext(
+            workload_, variableDatabase->getContext("WORKLOAD"),
+            SAMRAI::hier::IntVector::getZero(workload_->getDim()));
+    }
+
+    std::string name() { return name_; }
+
+    int workloadId() const { return workloadId_; }
+
+    template<typename Patch>
+    void allocate(Patch& patch, double const allocateTime) const
+    {
+        patch.allocatePatchData(workloadId_, allocateTime);
+    }
+
+    virtual void estimate(level_t& level, PHARE::solver::IPhysicalModel<amr_t>& model) = 0;
+
+    virtual ~LoadBalancerEstimator(){};
+
+private:
+    std::shared_ptr<SAMRAI::pdat::CellVariable<double>> workload_;
+    int workloadId_;
+};
+
+
+} // namespace PHARE::amr
+
+#endif
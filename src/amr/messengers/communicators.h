@@ -4,6 +4,7 @@
 #include "quantity_communicator.h"
 
 #include <SAMRAI/hier/RefineOperator.h>
+#include <SAMRAI/xfer/RefineTransactionFactory.h>
 
 #include <map>
 #include <memory>
@@ -20,7 +21,8 @@ namespace amr
         InitField,
         InitInteriorPart,
         LevelBorderParticles,
-        InteriorGhostParticles
+        InteriorGhostParticles,
+        PatchFieldBorderSum
     };
 
 
@@ -33,6 +35,20 @@ namespace amr
     class RefinerPool
     {
     public:
+        RefinerPool() = default;
+
+
+        /**
+         * @brief the schedules of the pool will make their transactions with the given factory,
+         * for pools of RefinerType::PatchFieldBorderSum, which sum values instead of copying them.
+         */
+        explicit RefinerPool(
+            std::shared_ptr<SAMRAI::xfer::RefineTransactionFactory> transactionFactory)
+            : transactionFactory_{std::move(transactionFactory)}
+        {
+        }
+
+
         /**
          * @brief add a QuantityCommunicator to the communicators based on the given Descriptor and
          * the refinement operator refineOp. The method uses the ResourcesManager to check the
@@ -54,6 +70,24 @@ namespace amr
         }
 
 
+        /**
+         * @brief add a QuantityCommunicator like the overload above, whose schedules compute the
+         * overlaps of the quantity with the given fill pattern.
+         */
+        template<typename ResourcesManager>
+        void add(std::string const& name,
+                 std::shared_ptr<SAMRAI::hier::RefineOperator> const& refineOp,
+                 std::shared_ptr<SAMRAI::xfer::VariableFillPattern> const& fillPattern,
+                 std::string const key, std::shared_ptr<ResourcesManager> const& rm)
+        {
+            auto const [it, success]
+                = refiners_.insert({key, makeRefiner(name, rm, refineOp, fillPattern)});
+
+            if (!success)
+                throw std::runtime_error(key + " is already registered");
+        }
+
+
         /**
          * @brief add a QuantityCommunicator to the Communicators based on the given descroptors and
          * spatial refinement operator and time interpolation operator. The created
@@ -80,6 +114,25 @@ namespace amr
 
 
 
+        /**
+         * @brief add a QuantityCommunicator summing, on the nodes the patches of a level share, the
+         * model fields of neighbor patches into the sum fields, see makeBorderSumRefiner()
+         */
+        template<typename ResourcesManager>
+        void addBorderSum(std::vector<std::string> const& sumNames,
+                          std::vector<std::string> const& modelNames, std::string const key,
+                          std::shared_ptr<ResourcesManager> const& rm)
+        {
+            auto const [it, success]
+                = refiners_.insert({key, makeBorderSumRefiner(sumNames, modelNames, rm)});
+
+            if (!success)
+                throw std::runtime_error(key + " is already registered");
+        }
+
+
+
+
         /**
          * @brief registerLevel registers a level of the hierarchy to all QuantityCommunicators in
          * the Communicators.
@@ -168,6 +221,15 @@ namespace amr
                 {
                     refiner.add(algo->createSchedule(level), levelNumber);
                 }
+
+                // this branch is used to create a schedule summing the values neighbor patches
+                // hold on the nodes they share, the transactions of the given factory adding the
+                // source values to the destination instead of copying them.
+                else if constexpr (Type == RefinerType::PatchFieldBorderSum)
+                {
+                    refiner.add(algo->createSchedule(level, nullptr, transactionFactory_),
+                                levelNumber);
+                }
             }
         }
 
@@ -284,6 +346,8 @@ namespace amr
 
 
         std::map<std::string, Communicator<Refiner>> refiners_;
+
+        std::shared_ptr<SAMRAI::xfer::RefineTransactionFactory> transactionFactory_;
     };
 
 
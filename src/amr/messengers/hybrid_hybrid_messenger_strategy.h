@@ -4,10 +4,13 @@
 
 #include "communicators.h"
 #include "amr/data/field/coarsening/field_coarsen_operator.h"
+#include "amr/data/field/field_data.h"
+#include "amr/data/field/field_sum_transaction.h"
 #include "amr/data/field/refine/field_refine_operator.h"
 #include "amr/data/field/time_interpolate/field_linear_time_interpolate.h"
 #include "amr/data/particles/refine/particles_data_split.h"
 #include "amr/data/particles/refine/split.h"
+#include "amr/data/particles/particles_variable_fill_pattern.h"
 #include "amr/messengers/messenger_info.h"
 #include "amr/messengers/hybrid_messenger_info.h"
 #include "amr/messengers/hybrid_messenger_strategy.h"
@@ -34,6 +37,62 @@ namespace PHARE
 {
 namespace amr
 {
+    /** \brief PopulationMoments holds, for one ion population, a density and flux the
+     * HybridHybridMessengerStrategy works with besides those of the population : the sums on the
+     * nodes neighbor patches share, or the moments of level ghost particles.
+     */
+    template<typename VecFieldT>
+    struct PopulationMoments
+    {
+        using field_type = typename VecFieldT::field_type;
+
+        struct MomentsProperty
+        {
+            std::string name;
+            typename core::HybridQuantity::Scalar qty;
+        };
+
+        using MomentProperties = std::vector<MomentsProperty>;
+
+
+        PopulationMoments(std::string const& popDensityName, std::string const& popFluxName,
+                          std::string const& suffix)
+            : densityName{popDensityName + suffix}
+            , flux{popFluxName + suffix, core::HybridQuantity::Vector::V}
+        {
+        }
+
+
+        MomentProperties getFieldNamesAndQuantities() const
+        {
+            return {{{densityName, core::HybridQuantity::Scalar::rho}}};
+        }
+
+        void setBuffer(std::string const& bufferName, field_type* field)
+        {
+            if (bufferName == densityName)
+                density = field;
+            else
+                throw std::runtime_error("Error - invalid population moments buffer name");
+        }
+
+        auto getCompileTimeResourcesUserList() { return std::forward_as_tuple(flux); }
+
+        auto getCompileTimeResourcesUserList() const { return std::forward_as_tuple(flux); }
+
+        bool isUsable() const { return density != nullptr && flux.isUsable(); }
+
+        bool isSettable() const { return density == nullptr && flux.isSettable(); }
+
+
+        std::string densityName;
+        field_type* density = nullptr;
+        VecFieldT flux;
+    };
+
+
+
+
     /** \brief An HybridMessenger is the specialization of a HybridMessengerStrategy for hybrid to
      * hybrid data communications.
      */
@@ -61,10 +120,11 @@ namespace amr
 
 
         HybridHybridMessengerStrategy(std::shared_ptr<ResourcesManagerT> manager,
-                                      int const firstLevel)
+                                      int const firstLevel, bool const sumBorderMoments = false)
             : HybridMessengerStrategy<HybridModel>{stratName}
             , resourcesManager_{std::move(manager)}
             , firstLevel_{firstLevel}
+            , sumBorderMoments_{sumBorderMoments}
         {
             resourcesManager_->registerResources(EM_old_);
             resourcesManager_->registerResources(Jold_);
@@ -86,6 +146,15 @@ namespace amr
         {
             resourcesManager_->allocate(EM_old_, patch, allocateTime);
             resourcesManager_->allocate(Jold_, patch, allocateTime);
+
+            for (auto& momentSum : momentSums_)
+                resourcesManager_->allocate(momentSum, patch, allocateTime);
+
+            for (auto& moments : levelGhostOldMoments_)
+                resourcesManager_->allocate(moments, patch, allocateTime);
+
+            for (auto& moments : levelGhostNewMoments_)
+                resourcesManager_->allocate(moments, patch, allocateTime);
         }
 
 
@@ -107,6 +176,10 @@ namespace amr
             registerGhostComms_(hybridInfo);
             registerInitComms(hybridInfo);
             registerSyncComms(hybridInfo);
+            registerLevelGhostMoments_(hybridInfo);
+
+            if (sumBorderMoments_)
+                registerMomentSumComms_(hybridInfo);
         }
 
 
@@ -125,7 +198,8 @@ namespace amr
          *
          *  ion moments : do not need to be filled on ghost node by SAMRAI schedules
          *  since they will be filled with levelGhostParticles[old,new] on level ghost nodes
-         *  and computed by ghost particles on interior patch ghost nodes
+         *  and computed by ghost particles on interior patch ghost nodes, unless border moments
+         *  are summed, in which case the sum schedules need to know the level
          *
          *
          * Init communicators that need to know this level :
@@ -150,6 +224,8 @@ namespace amr
 
             patchGhostParticles_.registerLevel(hierarchy, level);
 
+            momentBorderSums_.registerLevel(hierarchy, level);
+
             // root level is not initialized with a schedule using coarser level data
             // so we don't create these schedules if root level
             if (levelNumber != rootLevelNumber)
@@ -185,8 +261,17 @@ namespace amr
             magneticInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             electricInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             interiorParticles_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            levelGhostParticlesOld_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            copyLevelGhostOldToPushable_(*level, model);
+
+            // the root level has no coarser level to take level ghost particles from, it is
+            // only regridded when its patches are redistributed among ranks
+            if (levelNumber > 0)
+            {
+                levelGhostParticlesOld_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
+                copyLevelGhostOldToPushable_(*level, model);
+
+                levelGhostOldMomentsValid_[levelNumber] = false;
+                levelGhostNewMomentsValid_[levelNumber] = false;
+            }
 
             // computeIonMoments_(*level, model);
             // levelGhostNew will be refined in next firstStep
@@ -245,6 +330,8 @@ namespace amr
 
 
             levelGhostParticlesOld_.fill(levelNumber, initDataTime);
+            levelGhostOldMomentsValid_[levelNumber] = false;
+            levelGhostNewMomentsValid_[levelNumber] = false;
 
 
             // levelGhostParticles will be pushed during the advance phase
@@ -303,7 +390,9 @@ namespace amr
 
         /**
          * @brief fillIonGhostParticles will fill the interior ghost particle array from neighbor
-         * patches of the same level. Before doing that, it empties the array for all populations
+         * patches of the same level. Before doing that, it empties the array for all populations.
+         * Domain particles are indexed by cell for the duration of the fill, which then only reads
+         * those of the cells near patch borders.
          */
         void fillIonGhostParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                    double const fillTime) override
@@ -319,18 +408,54 @@ namespace amr
                 }
             }
 
+            CellIndexGuard cellIndex{*this, ions, level};
             patchGhostParticles_.fill(level.getLevelNumber(), fillTime);
         }
 
 
 
 
+        /**
+         * @brief fillIonPatchGhostMoments completes the ion moments each patch deposited from its
+         * domain particles on the nodes it shares with neighbor patches, by depositing its patch
+         * ghost particles or, if border moments are summed, by adding the moments the neighbor
+         * patches deposited from their own particles on these nodes, see sumMomentsOnBorders_().
+         */
+        void fillIonPatchGhostMoments(IonsT& ions, SAMRAI::hier::PatchLevel& level,
+                                      double const fillTime) override
+        {
+            PHARE_LOG_SCOPE("HybridHybridMessengerStrategy::fillIonPatchGhostMoments");
+
+            if (sumBorderMoments_)
+            {
+                sumMomentsOnBorders_(ions, level, fillTime);
+                return;
+            }
+
+            for (auto patch : level)
+            {
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto layout      = layoutFromPatch<GridLayoutT>(*patch);
+
+                for (auto& pop : ions)
+                {
+                    auto& patchGhosts = pop.patchGhostParticles();
+                    interpolate_(std::begin(patchGhosts), std::end(patchGhosts), pop.density(),
+                                 pop.flux(), layout);
+                }
+            }
+        }
+
+
+
+
         /**
          * @brief fillIonMomentGhosts will compute the ion moments for all species on ghost nodes.
          *
-         * For patch ghost nodes, patch ghost particles are used.
-         * For level ghost nodes, levelGhostParticlesOld and new are both projected with a time
-         * interpolation coef.
+         * Patch ghost nodes are first completed by fillIonPatchGhostMoments().
+         * For level ghost nodes, the moments of levelGhostParticlesOld and new are combined with a
+         * time interpolation coef. Since these particles do not change during the substeps, they
+         * are only deposited once per coarse step, see depositLevelGhostMoments_().
          */
         void fillIonMomentGhosts(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                  double const beforePushTime, double const afterPushTime) override
@@ -347,33 +472,40 @@ namespace amr
                                          + std::to_string(afterPushTime) + " on level "
                                          + std::to_string(level.getLevelNumber()));
             }
+
+            fillIonPatchGhostMoments(ions, level, afterPushTime);
+
+            if (level.getLevelNumber() == 0) // no levelGhost on root level
+                return;
+
+            depositLevelGhostMoments_(ions, level);
+
             for (auto patch : level)
             {
                 auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
-                auto layout      = layoutFromPatch<GridLayoutT>(*patch);
 
+                std::size_t popIndex = 0;
                 for (auto& pop : ions)
                 {
-                    // first thing to do is to project patchGhostParitcles moments
-                    auto& patchGhosts = pop.patchGhostParticles();
-                    auto& density     = pop.density();
-                    auto& flux        = pop.flux();
-
-                    interpolate_(std::begin(patchGhosts), std::end(patchGhosts), density, flux,
-                                 layout);
-
-                    if (level.getLevelNumber() > 0) // no levelGhost on root level
+                    auto& density = pop.density();
+                    auto& flux    = pop.flux();
+
+                    // grab the moments of levelGhostParticlesOld and levelGhostParticlesNew
+                    // and add them with (1-alpha) and alpha coefs
+                    auto& oldMoments = levelGhostOldMoments_[popIndex];
+                    auto& newMoments = levelGhostNewMoments_[popIndex];
+                    auto momentsOnPatch
+                        = resourcesManager_->setOnPatch(*patch, oldMoments, newMoments);
+
+                    addTimeInterpolated_(density, *oldMoments.density, *newMoments.density, alpha);
+                    for (auto const component :
+                         {core::Component::X, core::Component::Y, core::Component::Z})
                     {
-                        // then grab levelGhostParticlesOld and levelGhostParticlesNew
-                        // and project them with alpha and (1-alpha) coefs, respectively
-                        auto& levelGhostOld = pop.levelGhostParticlesOld();
-                        interpolate_(std::begin(levelGhostOld), std::end(levelGhostOld), density,
-                                     flux, layout, 1. - alpha);
-
-                        auto& levelGhostNew = pop.levelGhostParticlesNew();
-                        interpolate_(std::begin(levelGhostNew), std::end(levelGhostNew), density,
-                                     flux, layout, alpha);
+                        addTimeInterpolated_(flux.getComponent(component),
+                                             oldMoments.flux.getComponent(component),
+                                             newMoments.flux.getComponent(component), alpha);
                     }
+                    ++popIndex;
                 }
             }
         }
@@ -409,6 +541,7 @@ namespace amr
                 PHARE_LOG_START("HybridHybridMessengerStrategy::firstStep.fill");
                 levelGhostParticlesNew_.fill(levelNumber, currentTime);
                 PHARE_LOG_STOP("HybridHybridMessengerStrategy::firstStep.fill");
+                levelGhostNewMomentsValid_[levelNumber] = false;
 
                 // during firstStep() coarser level and current level are at the same time
                 // so 'time' is also the beforePushCoarseTime_
@@ -424,7 +557,8 @@ namespace amr
          * moves levelGhostParticlesNew particles into levelGhostParticlesOld ones. Then
          * levelGhostParticlesNew are emptied since it will be filled again at firstStep of the next
          * substepping cycle. the new CoarseToFineOld content is then copied to levelGhostParticles
-         * so that they can be pushed during the next subcycle
+         * so that they can be pushed during the next subcycle. The moments of
+         * levelGhostParticlesNew become those of levelGhostParticlesOld the same way.
          */
         void lastStep(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level) override
         {
@@ -432,11 +566,29 @@ namespace amr
             {
                 PHARE_LOG_SCOPE("HybridHybridMessengerStrategy::lastStep");
 
+                auto const levelNumber     = level.getLevelNumber();
+                bool const newMomentsValid = levelGhostNewMomentsValid_[levelNumber];
+
                 auto& hybridModel = static_cast<HybridModel&>(model);
                 for (auto& patch : level)
                 {
                     auto& ions       = hybridModel.state.ions;
                     auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+
+                    if (newMomentsValid)
+                    {
+                        for (std::size_t i = 0; i < levelGhostNewMoments_.size(); ++i)
+                        {
+                            auto& oldMoments = levelGhostOldMoments_[i];
+                            auto& newMoments = levelGhostNewMoments_[i];
+                            auto momentsOnPatch
+                                = resourcesManager_->setOnPatch(*patch, oldMoments, newMoments);
+
+                            oldMoments.density->copyData(*newMoments.density);
+                            oldMoments.flux.copyData(newMoments.flux);
+                        }
+                    }
+
                     for (auto& pop : ions)
                     {
                         auto& levelGhostParticlesOld = pop.levelGhostParticlesOld();
@@ -467,6 +619,9 @@ namespace amr
                         }
                     }
                 }
+
+                levelGhostOldMomentsValid_[levelNumber] = newMomentsValid;
+                levelGhostNewMomentsValid_[levelNumber] = false;
             }
         }
 
@@ -553,6 +708,68 @@ namespace amr
         }
 
     private:
+        using ParticlesDataT = ParticlesData<typename IonsT::particle_array_type>;
+
+        /**
+         * @brief CellIndexGuard indexes by cell the domain particles of all populations on the
+         * patches of a level for its lifetime. The index is dropped on every exit path of the scope
+         * owning the guard, including when the schedule it was built for throws.
+         */
+        class CellIndexGuard
+        {
+        public:
+            CellIndexGuard(HybridHybridMessengerStrategy& strategy, IonsT& ions,
+                           SAMRAI::hier::PatchLevel& level)
+                : strategy_{strategy}
+                , ions_{ions}
+                , level_{level}
+            {
+                try
+                {
+                    strategy_.forParticlesData_(ions_, level_,
+                                                [](auto& data) { data.indexCells(); });
+                }
+                catch (...)
+                {
+                    drop_();
+                    throw;
+                }
+            }
+
+            ~CellIndexGuard() { drop_(); }
+
+            CellIndexGuard(CellIndexGuard const&) = delete;
+            CellIndexGuard& operator=(CellIndexGuard const&) = delete;
+
+        private:
+            void drop_()
+            {
+                strategy_.forParticlesData_(ions_, level_,
+                                            [](auto& data) { data.dropCellIndex(); });
+            }
+
+            HybridHybridMessengerStrategy& strategy_;
+            IonsT& ions_;
+            SAMRAI::hier::PatchLevel& level_;
+        };
+
+
+
+        // calls action on the ParticlesData of all populations on the patches of the level
+        template<typename Action>
+        void forParticlesData_(IonsT& ions, SAMRAI::hier::PatchLevel& level, Action&& action)
+        {
+            auto const ids = resourcesManager_->getIDs(ions);
+            for (auto patch : level)
+                for (auto const id : ids)
+                    if (auto data = std::dynamic_pointer_cast<ParticlesDataT>(
+                            patch->getPatchData(id)))
+                        action(*data);
+        }
+
+
+
+
         void registerGhostComms_(std::unique_ptr<HybridMessengerInfo> const& info)
         {
             auto const& Eold = EM_old_.E;
@@ -605,8 +822,173 @@ namespace amr
                           levelGhostParticlesNew_, info->levelGhostParticlesNew);
 
 
-            fillRefiners_(info->patchGhostParticles, nullptr, patchGhostParticles_,
-                          info->patchGhostParticles);
+            // patch ghost particles are not deposited when border moments are summed, only those
+            // entering the patch during the next push are needed, which lie within a cell of it
+            if (sumBorderMoments_)
+            {
+                auto const ghostBand = std::make_shared<ParticlesGhostBandFillPattern>();
+                for (auto const& pop : info->patchGhostParticles)
+                    patchGhostParticles_.add(pop, nullptr, ghostBand, pop, resourcesManager_);
+            }
+            else
+                fillRefiners_(info->patchGhostParticles, nullptr, patchGhostParticles_,
+                              info->patchGhostParticles);
+        }
+
+
+
+
+        /**
+         * @brief registerLevelGhostMoments_ creates, for each population, the fields in which the
+         * moments of levelGhostParticlesOld and levelGhostParticlesNew are kept for the substeps
+         */
+        void registerLevelGhostMoments_(std::unique_ptr<HybridMessengerInfo> const& info)
+        {
+            auto const& densities = info->ghostPopulationDensity;
+            auto const& fluxes    = info->ghostPopulationFlux;
+
+            for (std::size_t i = 0; i < fluxes.size(); ++i)
+            {
+                resourcesManager_->registerResources(levelGhostOldMoments_.emplace_back(
+                    densities[i], fluxes[i].vecName, "_levelGhostOld"));
+                resourcesManager_->registerResources(levelGhostNewMoments_.emplace_back(
+                    densities[i], fluxes[i].vecName, "_levelGhostNew"));
+            }
+        }
+
+
+
+
+        /**
+         * @brief registerMomentSumComms_ creates, for each population, the sum fields and the
+         * communicators adding to them the density and flux of neighbor patches on shared nodes
+         */
+        void registerMomentSumComms_(std::unique_ptr<HybridMessengerInfo> const& info)
+        {
+            auto const& densities = info->ghostPopulationDensity;
+            auto const& fluxes    = info->ghostPopulationFlux;
+
+            for (std::size_t i = 0; i < fluxes.size(); ++i)
+            {
+                auto const& flux = fluxes[i];
+                auto& sum        = momentSums_.emplace_back(densities[i], flux.vecName, "_sum");
+                resourcesManager_->registerResources(sum);
+
+                auto const sumFlux = VecFieldDescriptor{sum.flux};
+                momentBorderSums_.addBorderSum(
+                    {sum.densityName, sumFlux.xName, sumFlux.yName, sumFlux.zName},
+                    {densities[i], flux.xName, flux.yName, flux.zName}, flux.vecName,
+                    resourcesManager_);
+            }
+        }
+
+
+
+
+        /**
+         * @brief sumMomentsOnBorders_ adds to the density and flux of each population the values
+         * neighbor patches deposited from their own particles on the nodes they share.
+         *
+         * The moments are first copied in the sum fields, which the schedules then complete by
+         * reading the moments of the neighbors, that are left untouched until all transactions
+         * are done, and the sums are finally copied back in the moments.
+         */
+        void sumMomentsOnBorders_(IonsT& ions, SAMRAI::hier::PatchLevel& level, double const time)
+        {
+            PHARE_LOG_SCOPE("HybridHybridMessengerStrategy::sumMomentsOnBorders_");
+
+            auto copyMoments = [&](bool const toSums) {
+                for (auto patch : level)
+                {
+                    auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+
+                    std::size_t i = 0;
+                    for (auto& pop : ions)
+                    {
+                        auto& sum    = momentSums_[i++];
+                        auto sumData = resourcesManager_->setOnPatch(*patch, sum);
+                        if (toSums)
+                        {
+                            sum.density->copyData(pop.density());
+                            sum.flux.copyData(pop.flux());
+                        }
+                        else
+                        {
+                            pop.density().copyData(*sum.density);
+                            pop.flux().copyData(sum.flux);
+                        }
+                    }
+                }
+            };
+
+            copyMoments(true);
+            momentBorderSums_.fill(level.getLevelNumber(), time);
+            copyMoments(false);
+        }
+
+
+
+
+        /**
+         * @brief depositLevelGhostMoments_ deposits, on all patches of the level, the
+         * levelGhostParticlesOld and levelGhostParticlesNew of each population in the fields
+         * keeping their moments, unless this was already done since these particles changed.
+         */
+        void depositLevelGhostMoments_(IonsT& ions, SAMRAI::hier::PatchLevel& level)
+        {
+            auto const levelNumber = level.getLevelNumber();
+            bool& oldMomentsValid  = levelGhostOldMomentsValid_[levelNumber];
+            bool& newMomentsValid  = levelGhostNewMomentsValid_[levelNumber];
+
+            if (oldMomentsValid and newMomentsValid)
+                return;
+
+            PHARE_LOG_SCOPE("HybridHybridMessengerStrategy::depositLevelGhostMoments_");
+
+            auto deposit = [&](auto& particles, auto& moments, auto const& layout) {
+                moments.density->zero();
+                moments.flux.zero();
+                interpolate_(std::begin(particles), std::end(particles), *moments.density,
+                             moments.flux, layout);
+            };
+
+            for (auto patch : level)
+            {
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto layout      = layoutFromPatch<GridLayoutT>(*patch);
+
+                std::size_t popIndex = 0;
+                for (auto& pop : ions)
+                {
+                    auto& oldMoments = levelGhostOldMoments_[popIndex];
+                    auto& newMoments = levelGhostNewMoments_[popIndex];
+                    auto momentsOnPatch
+                        = resourcesManager_->setOnPatch(*patch, oldMoments, newMoments);
+
+                    if (!oldMomentsValid)
+                        deposit(pop.levelGhostParticlesOld(), oldMoments, layout);
+                    if (!newMomentsValid)
+                        deposit(pop.levelGhostParticlesNew(), newMoments, layout);
+                    ++popIndex;
+                }
+            }
+
+            oldMomentsValid = true;
+            newMomentsValid = true;
+        }
+
+
+
+
+        //! adds to the moment its level ghost moments at t_coarse and t_coarse+dt_coarse
+        //! weighted by (1-alpha) and alpha, they are zero away from the level border
+        static void addTimeInterpolated_(FieldT& moment, FieldT const& oldMoment,
+                                         FieldT const& newMoment, double const alpha)
+        {
+            auto oldValue = std::begin(oldMoment);
+            auto newValue = std::begin(newMoment);
+            for (auto& value : moment)
+                value += (1. - alpha) * *oldValue++ + alpha * *newValue++;
         }
 
 
@@ -727,6 +1109,9 @@ namespace amr
 
 
         int const firstLevel_;
+
+        //! if true, moments on shared border nodes are summed instead of deposited by patch ghosts
+        bool const sumBorderMoments_;
         std::unordered_map<std::size_t, double> beforePushCoarseTime_;
         std::unordered_map<std::size_t, double> afterPushCoarseTime_;
 
@@ -765,6 +1150,18 @@ namespace amr
         // keys : model particles (initialization and 2nd push), temporaryParticles (firstPush)
         RefinerPool<RefinerType::InteriorGhostParticles> patchGhostParticles_;
 
+        //! sum fields of the population moments, and communicators summing them on border nodes
+        std::vector<PopulationMoments<VecFieldT>> momentSums_;
+
+        //! moments of levelGhostParticlesOld and levelGhostParticlesNew of each population, and
+        //! for each level whether they were deposited since these particles last changed
+        std::vector<PopulationMoments<VecFieldT>> levelGhostOldMoments_;
+        std::vector<PopulationMoments<VecFieldT>> levelGhostNewMoments_;
+        std::unordered_map<std::size_t, bool> levelGhostOldMomentsValid_;
+        std::unordered_map<std::size_t, bool> levelGhostNewMomentsValid_;
+        RefinerPool<RefinerType::PatchFieldBorderSum> momentBorderSums_{
+            std::make_shared<FieldBorderSumTransactionFactory<FieldData<GridLayoutT, FieldT>>>()};
+
         SynchronizerPool<dimension> densitySynchronizers_;
 
         SynchronizerPool<dimension> ionBulkVelSynchronizers_;
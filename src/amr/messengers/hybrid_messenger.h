@@ -320,6 +320,21 @@ namespace amr
 
 
 
+        /**
+         * @brief fillIonPatchGhostMoments completes, on the nodes patches share, the ion moments
+         * deposited from the domain particles of each patch
+         * @param ions
+         * @param level
+         * @param fillTime
+         */
+        void fillIonPatchGhostMoments(IonsT& ions, SAMRAI::hier::PatchLevel& level,
+                                      double const fillTime)
+        {
+            strat_->fillIonPatchGhostMoments(ions, level, fillTime);
+        }
+
+
+
         /**
          * @brief fillIonMomentGhosts is called by a ISolver solving hybrid equations to fill the
          * ion moments
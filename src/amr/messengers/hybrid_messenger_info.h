@@ -98,6 +98,13 @@ namespace amr
         std::vector<VecFieldDescriptor> ghostCurrent;
 
 
+        //! names of the population densities and fluxes completed by
+        //! HybridMessenger::fillIonMomentGhosts, on level ghost nodes and on the nodes
+        //! neighbor patches share
+        std::vector<FieldDescriptor> ghostPopulationDensity;
+        std::vector<VecFieldDescriptor> ghostPopulationFlux;
+
+
         virtual ~HybridMessengerInfo() = default;
     };
 
@@ -84,6 +84,11 @@ namespace amr
             = 0;
 
 
+        virtual void fillIonPatchGhostMoments(IonsT& ions, SAMRAI::hier::PatchLevel& level,
+                                              double const fillTime)
+            = 0;
+
+
         virtual void fillIonMomentGhosts(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                          double beforePushTime, double const afterPushTime)
             = 0;
@@ -83,10 +83,16 @@ public:
     {
         if (messengerName == HybridHybridMessengerStrategy_t::stratName)
         {
-            auto resourcesManager = dynamic_cast<HybridModel const&>(coarseModel).resourcesManager;
+            auto const& hybridModel = dynamic_cast<HybridModel const&>(coarseModel);
+            auto resourcesManager   = hybridModel.resourcesManager;
+
+            auto const& dict = hybridModel.dict;
+            bool const sumBorderMoments
+                = dict.contains("algo") and dict["algo"].contains("sum_border_moments")
+                  and dict["algo"]["sum_border_moments"].template to<int>() != 0;
 
             auto messengerStrategy = std::make_unique<HybridHybridMessengerStrategy_t>(
-                std::move(resourcesManager), firstLevel);
+                std::move(resourcesManager), firstLevel, sumBorderMoments);
 
             return std::make_unique<HybridMessenger<HybridModel>>(std::move(messengerStrategy));
         }
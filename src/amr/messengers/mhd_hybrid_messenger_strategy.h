@@ -115,6 +115,10 @@ namespace amr
                                    double const /*fillTime*/) override
         {
         }
+        void fillIonPatchGhostMoments(IonsT& /*ions*/, SAMRAI::hier::PatchLevel& /*level*/,
+                                      double const /*fillTime*/) override
+        {
+        }
         void fillIonMomentGhosts(IonsT& /*ions*/, SAMRAI::hier::PatchLevel& /*level*/,
                                  double const /*currentTime*/, double const /*fillTime*/) override
         {
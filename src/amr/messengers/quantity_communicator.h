@@ -9,6 +9,7 @@
 #include "amr/data/field/refine/field_refine_operator.h"
 #include "amr/data/field/time_interpolate/field_linear_time_interpolate.h"
 #include "amr/data/particles/refine/particles_data_split.h"
+#include "amr/data/particles/particles_variable_fill_pattern.h"
 #include <SAMRAI/tbox/Dimension.h>
 #include <SAMRAI/xfer/CoarsenAlgorithm.h>
 #include <SAMRAI/xfer/CoarsenSchedule.h>
@@ -287,6 +288,65 @@ namespace amr
 
 
 
+    /**
+     * @brief makeRefiner is similar to the overload above, except the schedules compute the
+     * overlaps of the quantity with the given fill pattern instead of its geometry.
+     */
+    template<typename ResourcesManager>
+    Communicator<Refiner>
+    makeRefiner(std::string const& name, std::shared_ptr<ResourcesManager> const& rm,
+                std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp,
+                std::shared_ptr<SAMRAI::xfer::VariableFillPattern> fillPattern)
+    {
+        Communicator<Refiner> communicator;
+
+        auto id = rm->getID(name);
+        if (id)
+        {
+            communicator.algo->registerRefine(*id, *id, *id, refineOp, fillPattern);
+        }
+
+        return communicator;
+    }
+
+
+
+    /**
+     * @brief makeBorderSumRefiner creates a QuantityRefiner whose schedules add, to each sum
+     * field, the model field of the neighbor patches, where their ghost boxes overlap.
+     *
+     * The sum fields are both destination and scratch, so that sums are not copied over, and
+     * the model fields are only read, so that each patch receives the values its neighbors
+     * computed themselves, whatever the order in which transactions are performed.
+     */
+    template<typename ResourcesManager>
+    Communicator<Refiner> makeBorderSumRefiner(std::vector<std::string> const& sumNames,
+                                               std::vector<std::string> const& modelNames,
+                                               std::shared_ptr<ResourcesManager> const& rm)
+    {
+        std::shared_ptr<SAMRAI::xfer::VariableFillPattern> fillPattern
+            = std::make_shared<FieldBorderSumFillPattern>();
+
+        Communicator<Refiner> com;
+
+        for (std::size_t i = 0; i < sumNames.size(); ++i)
+        {
+            auto sum_id   = rm->getID(sumNames[i]);
+            auto model_id = rm->getID(modelNames[i]);
+
+            if (sum_id && model_id)
+            {
+                // dest, src, scratch
+                com.algo->registerRefine(*sum_id, *model_id, *sum_id, nullptr, fillPattern);
+            }
+        }
+
+        return com;
+    }
+
+
+
+
     /**
      * @brief makeInitRefiner is similar to makeGhostRefiner except the registerRefine() that is
      * called is the one that allows initialization of a vector field quantity.
@@ -2,6 +2,7 @@
 #ifndef PHARE_MULTIPHYSICS_INTEGRATOR_H
 #define PHARE_MULTIPHYSICS_INTEGRATOR_H
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -17,6 +18,8 @@
 
 #include "amr/messengers/messenger.h"
 #include "amr/tagging/tagger.h"
+#include "amr/load_balancing/load_balancer_estimator.h"
+#include "amr/wrappers/restart_state.h"
 #include "amr/physical_models/hybrid_model.h"
 #include "amr/physical_models/mhd_model.h"
 #include "amr/physical_models/physical_model.h"
@@ -138,6 +141,40 @@ namespace solver
 
 
 
+        /**
+         * @brief registerLoadBalancerEstimator registers the estimator filling the workload used
+         * by the load balancer on all levels. The workload data are then allocated with the data
+         * of the models and estimated each time a level is initialized or about to be regridded.
+         */
+        void registerLoadBalancerEstimator(
+            std::unique_ptr<PHARE::amr::LoadBalancerEstimator> loadBalancerEstimator)
+        {
+            if (loadBalancerEstimator_)
+            {
+                throw std::runtime_error("error - a load balancer estimator is already registered");
+            }
+            loadBalancerEstimator_ = std::move(loadBalancerEstimator);
+        }
+
+
+
+        /**
+         * @brief registerRestartState registers the state the simulation writes to restart files
+         * and restarts from. Levels are then taken from it when the hierarchy is first made or
+         * configured, if the simulation restarts.
+         */
+        void registerRestartState(std::shared_ptr<PHARE::amr::RestartState> restartState)
+        {
+            if (restartState_)
+            {
+                throw std::runtime_error("error - a restart state is already registered");
+            }
+            restartState_        = std::move(restartState);
+            restoredFromRestart_ = restartState_->restoresHierarchy();
+        }
+
+
+
         /**
          * @brief registerModel registers the model to the multiphysics integrator for a given level
          * range. The level index for the coarsest and finest must be greater or equal to zero, less
@@ -238,6 +275,56 @@ namespace solver
 
 
 
+        /**
+         * @brief estimateWorkload fills the workload of the given level with the registered
+         * LoadBalancerEstimator, if any.
+         */
+        void estimateWorkload(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
+                              int const levelNumber)
+        {
+            if (loadBalancerEstimator_)
+                loadBalancerEstimator_->estimate(*hierarchy->getPatchLevel(levelNumber),
+                                                 getModel_(levelNumber));
+        }
+
+
+
+
+        /**
+         * @brief registerFinerLevels registers again all levels finer than the coarsest one to
+         * their messenger. It is needed when the coarsest level has been remade while finer
+         * levels were kept, since their schedules still refer to the former coarsest level.
+         */
+        void registerFinerLevels(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy)
+        {
+            for (auto ilvl = 1; ilvl <= hierarchy->getFinestLevelNumber(); ++ilvl)
+                getMessengerWithCoarser_(ilvl).registerLevel(hierarchy, ilvl);
+        }
+
+
+
+
+        /**
+         * @brief workTime returns the wall time, in seconds, this rank spent working on patches
+         * in the advanceLevel() of all solvers since the last call to resetWorkTime()
+         */
+        double workTime() const
+        {
+            double time = 0.;
+            for (auto const& solver : solvers_)
+                time += solver->workTime();
+            return time;
+        }
+
+        void resetWorkTime()
+        {
+            for (auto& solver : solvers_)
+                solver->resetWorkTime();
+        }
+
+
+
+
         std::string solverName(int const iLevel) const { return getSolver_(iLevel).name(); }
 
 
@@ -299,7 +386,13 @@ namespace solver
             auto& messenger        = getMessengerWithCoarser_(levelNumber);
             auto& levelInitializer = getLevelInitializer(model.name());
 
-            bool const isRegridding = oldLevel != nullptr;
+            // a simulation restarted on a different number of ranks makes its levels again,
+            // they take their data from the restarted ones as if they were regridded
+            auto previousLevel = oldLevel;
+            if (previousLevel == nullptr and restartState_)
+                previousLevel = restartState_->restartedLevel(levelNumber);
+
+            bool const isRegridding = previousLevel != nullptr;
             auto level              = hierarchy->getPatchLevel(levelNumber);
 
             std::cout << "init level " << levelNumber << " with regriding = " << isRegridding
@@ -311,6 +404,8 @@ namespace solver
                     model.allocate(*patch, initDataTime);
                     solver.allocate(model, *patch, initDataTime);
                     messenger.allocate(*patch, initDataTime);
+                    if (loadBalancerEstimator_)
+                        loadBalancerEstimator_->allocate(*patch, initDataTime);
                 }
             }
 
@@ -333,16 +428,54 @@ namespace solver
                 messenger.registerLevel(hierarchy, levelNumber);
             }
 
-            levelInitializer.initialize(hierarchy, levelNumber, oldLevel, model, messenger,
+            levelInitializer.initialize(hierarchy, levelNumber, previousLevel, model, messenger,
                                         initDataTime, isRegridding);
+
+            if (loadBalancerEstimator_)
+                loadBalancerEstimator_->estimate(*level, model);
         }
 
 
 
+        /**
+         * @brief see SAMRAI documentation. When restarting on as many ranks as wrote the restart
+         * files, levels are read from them instead of being initialized with
+         * initializeLevelData(), and this is the first time the MultiPhysicsIntegrator sees
+         * them. Their patch data are then allocated, the state of the simulation is read back
+         * and levels are registered to the messengers. This is only done the first time the
+         * hierarchy configuration is reset, regridded levels are initialized by
+         * initializeLevelData().
+         */
         void resetHierarchyConfiguration(
-            std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& /*hierarchy*/,
-            int const /*coarsestLevel*/, int const /*finestLevel*/) override
+            std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
+            int const coarsestLevel, int const finestLevel) override
         {
+            if (!restoredFromRestart_)
+                return;
+
+            for (auto levelNumber = coarsestLevel; levelNumber <= finestLevel; ++levelNumber)
+            {
+                auto& model     = getModel_(levelNumber);
+                auto& solver    = getSolver_(levelNumber);
+                auto& messenger = getMessengerWithCoarser_(levelNumber);
+                auto level      = hierarchy->getPatchLevel(levelNumber);
+                auto time       = level->getTime();
+
+                for (auto patch : *level)
+                {
+                    model.allocate(*patch, time);
+                    solver.allocate(model, *patch, time);
+                    messenger.allocate(*patch, time);
+                    if (loadBalancerEstimator_)
+                        loadBalancerEstimator_->allocate(*patch, time);
+                }
+                restartState_->restore(*level);
+
+                messenger.registerLevel(hierarchy, levelNumber);
+                estimateWorkload(hierarchy, levelNumber);
+            }
+
+            restoredFromRestart_ = false;
         }
 
 
@@ -361,6 +494,12 @@ namespace solver
                 auto& tagger = getTagger_(levelNumber);
                 tagger.tag(model, *patch, tag_index);
             }
+
+            // particles have moved since the last estimate, and the gridding algorithm is about
+            // to balance the level finer than this one, which also needs an up to date workload
+            auto const nextFiner = std::min(levelNumber + 1, hierarchy->getFinestLevelNumber());
+            for (auto ilvl = levelNumber; ilvl <= nextFiner; ++ilvl)
+                estimateWorkload(hierarchy, ilvl);
         }
 
 
@@ -545,6 +684,9 @@ namespace solver
         std::vector<std::unique_ptr<ISolver<AMR_Types>>> solvers_;
         std::vector<std::shared_ptr<IPhysicalModel<AMR_Types>>> models_;
         std::vector<std::shared_ptr<PHARE::amr::Tagger>> taggers_;
+        std::unique_ptr<PHARE::amr::LoadBalancerEstimator> loadBalancerEstimator_;
+        std::shared_ptr<PHARE::amr::RestartState> restartState_;
+        bool restoredFromRestart_ = false;
         std::map<std::string, std::unique_ptr<IMessengerT>> messengers_;
         std::map<std::string, std::unique_ptr<LevelInitializerT>> levelInitializers_;
         SimFunctors const& simFuncs_;
@@ -8,6 +8,7 @@
 
 #include "initializer/data_provider.h"
 #include "core/models/hybrid_state.h"
+#include "core/utilities/thread_pool.h"
 #include "amr/physical_models/physical_model.h"
 #include "core/data/ions/particle_initializers/particle_initializer_factory.h"
 #include "amr/resources_manager/resources_manager.h"
@@ -38,11 +39,14 @@ public:
     using particle_array_type       = typename Ions::particle_array_type;
     using resources_manager_type    = amr::ResourcesManager<gridlayout_type>;
     static constexpr auto dimension = GridLayoutT::dimension;
+    using state_type                = core::HybridState<Electromag, Ions, Electrons>;
     using ParticleInitializerFactory
         = core::ParticleInitializerFactory<particle_array_type, gridlayout_type>;
 
 
-    core::HybridState<Electromag, Ions, Electrons> state;
+    // kept so that other views on the state resources can be made, see SolverPPC
+    PHARE::initializer::PHAREDict const dict;
+    state_type state;
     std::shared_ptr<resources_manager_type> resourcesManager;
 
 
@@ -69,11 +73,18 @@ public:
     auto setOnPatch(patch_t& patch) { return resourcesManager->setOnPatch(patch, *this); }
 
 
-    HybridModel(PHARE::initializer::PHAREDict const& dict,
+    /** particles of a patch are loaded by "ions/nbr_threads" threads (default 1), of a pool
+     * shared by the initializers of all patches and populations
+     */
+    HybridModel(PHARE::initializer::PHAREDict const& _dict,
                 std::shared_ptr<resources_manager_type> const& _resourcesManager)
         : IPhysicalModel<AMR_Types>{model_name}
+        , dict{_dict}
         , state{dict}
         , resourcesManager{std::move(_resourcesManager)}
+        , particleLoadPool_{dict["ions"].contains("nbr_threads")
+                                ? dict["ions"]["nbr_threads"].template to<std::size_t>()
+                                : 1}
     {
     }
 
@@ -95,6 +106,9 @@ public:
     //-------------------------------------------------------------------------
     //                  ends the ResourcesUser interface
     //-------------------------------------------------------------------------
+
+private:
+    core::ThreadPool particleLoadPool_;
 };
 
 
@@ -119,7 +133,7 @@ void HybridModel<GridLayoutT, Electromag, Ions, Electrons, AMR_Types>::initializ
         for (auto& pop : ions)
         {
             auto const& info         = pop.particleInitializerInfo();
-            auto particleInitializer = ParticleInitializerFactory::create(info);
+            auto particleInitializer = ParticleInitializerFactory::create(info, particleLoadPool_);
             particleInitializer->loadParticles(pop.domainParticles(), layout);
         }
 
@@ -158,6 +172,12 @@ void HybridModel<GridLayoutT, Electromag, Ions, Electrons, AMR_Types>::fillMesse
     transform_(state.ions, modelInfo.levelGhostParticlesOld);
     transform_(state.ions, modelInfo.levelGhostParticlesNew);
     transform_(state.ions, modelInfo.patchGhostParticles);
+
+    for (auto const& pop : state.ions)
+    {
+        modelInfo.ghostPopulationDensity.push_back(pop.densityName());
+        modelInfo.ghostPopulationFlux.emplace_back(pop.flux());
+    }
 }
 
 
@@ -85,6 +85,18 @@ namespace solver
 
 
 
+        /**
+         * @brief workTime returns the wall time, in seconds, spent by the solver working on
+         * patches since the last call to resetWorkTime(). Unlike the duration of advanceLevel(),
+         * it does not include the time spent waiting for other ranks in communications.
+         */
+        double workTime() const { return workTime_; }
+
+        void resetWorkTime() { workTime_ = 0.; }
+
+
+
+
         virtual ~ISolver() = default;
 
 
@@ -94,6 +106,7 @@ namespace solver
         {
         }
         std::string solverName;
+        double workTime_ = 0.;
     };
 
 
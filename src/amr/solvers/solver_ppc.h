@@ -29,8 +29,17 @@
 #include "core/data/vecfield/vecfield.h"
 #include "core/data/grid/gridlayout_utils.h"
 
+#include "core/utilities/task_queue.h"
+#include "core/utilities/thread_pool.h"
 
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
 #include <iomanip>
+#include <memory>
+#include <vector>
 
 namespace PHARE::solver
 {
@@ -52,16 +61,52 @@ private:
     using IPhysicalModel_t = IPhysicalModel<AMR_Types>;
     using IMessenger       = amr::IMessenger<IPhysicalModel_t>;
     using HybridMessenger  = amr::HybridMessenger<HybridModel>;
+    using IonUpdater       = PHARE::core::IonUpdater<Ions, Electromag, GridLayout>;
 
 
     Electromag electromagPred_{"EMPred"};
     Electromag electromagAvg_{"EMAvg"};
 
 
-    PHARE::core::Faraday<GridLayout> faraday_;
-    PHARE::core::Ampere<GridLayout> ampere_;
-    PHARE::core::Ohm<GridLayout> ohm_;
-    PHARE::core::IonUpdater<Ions, Electromag, GridLayout> ionUpdater_;
+    /** a thread advancing patches needs its own views on the patch data, which setOnPatch
+     * binds, and its own operators, which hold a layout or scratch data.
+     */
+    struct ThreadState
+    {
+        ThreadState(PHARE::initializer::PHAREDict const& modelDict,
+                    PHARE::initializer::PHAREDict const& dict)
+            : state{modelDict}
+            , ohm{dict["ohm"]}
+            , ionUpdater{dict["ion_updater"]}
+        {
+        }
+
+        typename HybridModel::state_type state;
+        Electromag electromagPred{"EMPred"};
+        Electromag electromagAvg{"EMAvg"};
+
+        PHARE::core::Faraday<GridLayout> faraday;
+        PHARE::core::Ampere<GridLayout> ampere;
+        PHARE::core::Ohm<GridLayout> ohm;
+        IonUpdater ionUpdater;
+    };
+
+
+    /** time n particles of a patch, set aside by moveIons_ in UpdaterMode::domain_only while
+     * the patch arrays hold the predicted particles the messenger exchanges, see restoreState_,
+     * and the bulk particles of the split-phase push, see IonUpdater::updateBorder()
+     */
+    using TimeNParticles = typename IonUpdater::AsideParticles;
+
+    PHARE::initializer::PHAREDict const dict_;
+    PHARE::core::ThreadPool threadPool_;
+    std::vector<std::unique_ptr<ThreadState>> threadStates_;
+
+    // pushes the bulk of the particles while ghost particles are exchanged, if set
+    std::unique_ptr<PHARE::core::TaskQueue> bulkPush_;
+
+    // indexed by the local id of the patches of the level being advanced
+    std::vector<TimeNParticles> timeNParticles_;
 
 
 
@@ -72,11 +117,20 @@ public:
 
 
 
+    /** patches of a level are advanced by "nbr_threads" threads (default 1).
+     * If "overlap_ghost_exchange" is not 0 (default 0), ions are pushed in two phases, the bulk
+     * of the particles being pushed while ghost particles are exchanged, on the levels where no
+     * particle can cross a cell in a step, see moveIons_
+     */
     explicit SolverPPC(PHARE::initializer::PHAREDict const& dict)
         : ISolver<AMR_Types>{"PPC"}
-        , ohm_{dict["ohm"]}
-        , ionUpdater_{dict["ion_updater"]}
-
+        , dict_{dict}
+        , threadPool_{dict.contains("nbr_threads") ? dict["nbr_threads"].template to<std::size_t>()
+                                                   : 1}
+        , bulkPush_{dict.contains("overlap_ghost_exchange")
+                            and dict["overlap_ghost_exchange"].template to<int>() != 0
+                        ? std::make_unique<PHARE::core::TaskQueue>(1)
+                        : nullptr}
     {
     }
 
@@ -121,14 +175,19 @@ private:
     void average_(level_t& level, HybridModel& model);
 
 
-    void moveIons_(level_t& level, Ions& ions, Electromag& electromag, ResourcesManager& rm,
-                   Messenger& fromCoarser, double const currentTime, double const newTime,
-                   core::UpdaterMode mode);
+    void moveIons_(level_t& level, HybridModel& model, Messenger& fromCoarser,
+                   double const currentTime, double const newTime, core::UpdaterMode mode);
 
 
-    void saveState_(level_t& level, Ions& ions, ResourcesManager& rm);
+    /** calls fn(patch, threadState) for each patch of the level, patches being shared
+     * among the threads of the pool. The time it takes is added to the solver work time.
+     */
+    template<typename Fn>
+    void forEachPatch_(level_t& level, HybridModel const& model, Fn&& fn);
 
-    void restoreState_(level_t& level, Ions& ions, ResourcesManager& rm);
+
+    /** gives back to the patches of the level the particles set aside in domain_only mode */
+    void restoreState_(level_t& level, HybridModel& model);
 
     /*
     template<typename HybridMessenger>
@@ -139,11 +198,6 @@ private:
     }*/
 
 
-    // extend lifespan
-    std::unordered_map<std::string, ParticleArray> tmpDomain;
-    std::unordered_map<std::string, ParticleArray> patchGhost;
-
-
 }; // end solverPPC
 
 
@@ -190,38 +244,54 @@ void SolverPPC<HybridModel, AMR_Types>::fillMessengerInfo(
 
 
 template<typename HybridModel, typename AMR_Types>
-void SolverPPC<HybridModel, AMR_Types>::saveState_(level_t& level, Ions& ions, ResourcesManager& rm)
+template<typename Fn>
+void SolverPPC<HybridModel, AMR_Types>::forEachPatch_(level_t& level, HybridModel const& model,
+                                                      Fn&& fn)
 {
+    // thread states need the model dictionary, so they are only made once a model is given
+    if (threadStates_.empty())
+        for (std::size_t i = 0; i < threadPool_.size(); ++i)
+            threadStates_.emplace_back(std::make_unique<ThreadState>(model.dict, dict_));
+
+    std::vector<std::shared_ptr<patch_t>> patches;
     for (auto& patch : level)
-    {
-        std::stringstream ss;
-        ss << patch->getGlobalId();
+        patches.push_back(patch);
 
-        auto _ = rm.setOnPatch(*patch, ions);
-        for (auto& pop : ions)
-        {
-            tmpDomain[ss.str() + "_" + pop.name()]  = pop.domainParticles();
-            patchGhost[ss.str() + "_" + pop.name()] = pop.patchGhostParticles();
-        }
-    }
+    auto const start = std::chrono::steady_clock::now();
+
+    threadPool_.parallel_for(patches.size(), [&](std::size_t iPatch, std::size_t threadIdx) {
+        fn(*patches[iPatch], *threadStates_[threadIdx]);
+    });
+
+    this->workTime_
+        += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 }
 
+
+
 template<typename HybridModel, typename AMR_Types>
-void SolverPPC<HybridModel, AMR_Types>::restoreState_(level_t& level, Ions& ions,
-                                                      ResourcesManager& rm)
+void SolverPPC<HybridModel, AMR_Types>::restoreState_(level_t& level, HybridModel& model)
 {
-    for (auto& patch : level)
-    {
-        std::stringstream ss;
-        ss << patch->getGlobalId();
+    PHARE_LOG_SCOPE("SolverPPC::restoreState_");
 
-        auto _ = rm.setOnPatch(*patch, ions);
-        for (auto& pop : ions)
+    auto& rm = *model.resourcesManager;
+
+    forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+        auto& timeN = timeNParticles_[static_cast<std::size_t>(patch.getLocalId().getValue())];
+
+        auto _ = rm.setOnPatch(patch, thread.state.ions);
+
+        std::size_t popIndex = 0;
+        for (auto& pop : thread.state.ions)
         {
-            pop.domainParticles()     = std::move(tmpDomain[ss.str() + "_" + pop.name()]);
-            pop.patchGhostParticles() = std::move(patchGhost[ss.str() + "_" + pop.name()]);
+            // arrays left aside keep their capacity for the next step
+            pop.domainParticles().swap(timeN.domain[popIndex]);
+            pop.patchGhostParticles().swap(timeN.patchGhost[popIndex]);
+            timeN.domain[popIndex].clear();
+            timeN.patchGhost[popIndex].clear();
+            ++popIndex;
         }
-    }
+    });
 }
 
 
@@ -233,11 +303,9 @@ void SolverPPC<HybridModel, AMR_Types>::advanceLevel(std::shared_ptr<hierarchy_t
 {
     PHARE_LOG_SCOPE("SolverPPC::advanceLevel");
 
-    auto& hybridModel      = dynamic_cast<HybridModel&>(model);
-    auto& hybridState      = hybridModel.state;
-    auto& fromCoarser      = dynamic_cast<HybridMessenger&>(fromCoarserMessenger);
-    auto& resourcesManager = *hybridModel.resourcesManager;
-    auto level             = hierarchy->getPatchLevel(levelNumber);
+    auto& hybridModel = dynamic_cast<HybridModel&>(model);
+    auto& fromCoarser = dynamic_cast<HybridMessenger&>(fromCoarserMessenger);
+    auto level        = hierarchy->getPatchLevel(levelNumber);
 
 
     predictor1_(*level, hybridModel, fromCoarser, currentTime, newTime);
@@ -245,18 +313,16 @@ void SolverPPC<HybridModel, AMR_Types>::advanceLevel(std::shared_ptr<hierarchy_t
 
     average_(*level, hybridModel);
 
-    saveState_(*level, hybridState.ions, resourcesManager);
-    moveIons_(*level, hybridState.ions, electromagAvg_, resourcesManager, fromCoarser, currentTime,
-              newTime, core::UpdaterMode::domain_only);
+    moveIons_(*level, hybridModel, fromCoarser, currentTime, newTime,
+              core::UpdaterMode::domain_only);
 
     predictor2_(*level, hybridModel, fromCoarser, currentTime, newTime);
 
 
     average_(*level, hybridModel);
 
-    restoreState_(*level, hybridState.ions, resourcesManager);
-    moveIons_(*level, hybridState.ions, electromagAvg_, resourcesManager, fromCoarser, currentTime,
-              newTime, core::UpdaterMode::all);
+    restoreState_(*level, hybridModel);
+    moveIons_(*level, hybridModel, fromCoarser, currentTime, newTime, core::UpdaterMode::all);
 
     corrector_(*level, hybridModel, fromCoarser, currentTime, newTime);
 
@@ -277,29 +343,27 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
     auto& hybridState      = model.state;
     auto& resourcesManager = model.resourcesManager;
     auto dt                = newTime - currentTime;
-    auto& electromag       = hybridState.electromag;
     auto levelNumber       = level.getLevelNumber();
 
 
     {
         PHARE_LOG_SCOPE("SolverPPC::predictor1_.faraday");
 
-        auto& Bpred = electromagPred_.B;
-        auto& B     = electromag.B;
-        auto& E     = electromag.E;
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& Bpred = thread.electromagPred.B;
+            auto& B     = thread.state.electromag.B;
+            auto& E     = thread.state.electromag.E;
 
-        for (auto& patch : level)
-        {
-            auto _      = resourcesManager->setOnPatch(*patch, Bpred, B, E);
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto __     = core::SetLayout(&layout, faraday_);
-            faraday_(B, E, Bpred, dt);
+            auto _      = resourcesManager->setOnPatch(patch, Bpred, B, E);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto __     = core::SetLayout(&layout, thread.faraday);
+            thread.faraday(B, E, Bpred, dt);
 
 
-            resourcesManager->setTime(Bpred, *patch, newTime);
-        }
+            resourcesManager->setTime(Bpred, patch, newTime);
+        });
 
-        fromCoarser.fillMagneticGhosts(Bpred, levelNumber, newTime);
+        fromCoarser.fillMagneticGhosts(electromagPred_.B, levelNumber, newTime);
     }
 
 
@@ -307,20 +371,18 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
     {
         PHARE_LOG_SCOPE("SolverPPC::predictor1_.ampere");
 
-        auto& Bpred = electromagPred_.B;
-        auto& J     = hybridState.J;
-
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& Bpred = thread.electromagPred.B;
+            auto& J     = thread.state.J;
 
-        for (auto& patch : level)
-        {
-            auto _      = resourcesManager->setOnPatch(*patch, Bpred, J);
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto __     = core::SetLayout(&layout, ampere_);
-            ampere_(Bpred, J);
+            auto _      = resourcesManager->setOnPatch(patch, Bpred, J);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto __     = core::SetLayout(&layout, thread.ampere);
+            thread.ampere(Bpred, J);
 
-            resourcesManager->setTime(J, *patch, newTime);
-        }
-        fromCoarser.fillCurrentGhosts(J, levelNumber, newTime);
+            resourcesManager->setTime(J, patch, newTime);
+        });
+        fromCoarser.fillCurrentGhosts(hybridState.J, levelNumber, newTime);
     }
 
 
@@ -328,25 +390,24 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
     {
         PHARE_LOG_SCOPE("SolverPPC::predictor1_.ohm");
 
-        auto& electrons = hybridState.electrons;
-        auto& Bpred     = electromagPred_.B;
-        auto& Epred     = electromagPred_.E;
-        auto& J         = hybridState.J;
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& electrons = thread.state.electrons;
+            auto& Bpred     = thread.electromagPred.B;
+            auto& Epred     = thread.electromagPred.E;
+            auto& J         = thread.state.J;
 
-        for (auto& patch : level)
-        {
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto _      = resourcesManager->setOnPatch(*patch, Bpred, Epred, J, electrons);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto _      = resourcesManager->setOnPatch(patch, Bpred, Epred, J, electrons);
             electrons.update(layout);
             auto& Ve = electrons.velocity();
             auto& Ne = electrons.density();
             auto& Pe = electrons.pressure();
-            auto __  = core::SetLayout(&layout, ohm_);
-            ohm_(Ne, Ve, Pe, Bpred, J, Epred);
-            resourcesManager->setTime(Epred, *patch, newTime);
-        }
+            auto __  = core::SetLayout(&layout, thread.ohm);
+            thread.ohm(Ne, Ve, Pe, Bpred, J, Epred);
+            resourcesManager->setTime(Epred, patch, newTime);
+        });
 
-        fromCoarser.fillElectricGhosts(Epred, levelNumber, newTime);
+        fromCoarser.fillElectricGhosts(electromagPred_.E, levelNumber, newTime);
     }
 }
 
@@ -368,66 +429,62 @@ void SolverPPC<HybridModel, AMR_Types>::predictor2_(level_t& level, HybridModel&
     {
         PHARE_LOG_SCOPE("SolverPPC::predictor2_.faraday");
 
-        auto& Bpred = electromagPred_.B;
-        auto& B     = hybridState.electromag.B;
-        auto& Eavg  = electromagAvg_.E;
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& Bpred = thread.electromagPred.B;
+            auto& B     = thread.state.electromag.B;
+            auto& Eavg  = thread.electromagAvg.E;
 
-        for (auto& patch : level)
-        {
-            auto _      = resourcesManager->setOnPatch(*patch, Bpred, B, Eavg);
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto __     = core::SetLayout(&layout, faraday_);
-            faraday_(B, Eavg, Bpred, dt);
+            auto _      = resourcesManager->setOnPatch(patch, Bpred, B, Eavg);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto __     = core::SetLayout(&layout, thread.faraday);
+            thread.faraday(B, Eavg, Bpred, dt);
 
-            resourcesManager->setTime(Bpred, *patch, newTime);
-        }
+            resourcesManager->setTime(Bpred, patch, newTime);
+        });
 
-        fromCoarser.fillMagneticGhosts(Bpred, levelNumber, newTime);
+        fromCoarser.fillMagneticGhosts(electromagPred_.B, levelNumber, newTime);
     }
 
 
     {
         PHARE_LOG_SCOPE("SolverPPC::predictor2_.ampere");
 
-        auto& Bpred = electromagPred_.B;
-        auto& J     = hybridState.J;
-
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& Bpred = thread.electromagPred.B;
+            auto& J     = thread.state.J;
 
-        for (auto& patch : level)
-        {
-            auto _      = resourcesManager->setOnPatch(*patch, Bpred, J);
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto __     = core::SetLayout(&layout, ampere_);
-            ampere_(Bpred, J);
+            auto _      = resourcesManager->setOnPatch(patch, Bpred, J);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto __     = core::SetLayout(&layout, thread.ampere);
+            thread.ampere(Bpred, J);
 
-            resourcesManager->setTime(J, *patch, newTime);
-        }
-        fromCoarser.fillCurrentGhosts(J, levelNumber, newTime);
+            resourcesManager->setTime(J, patch, newTime);
+        });
+        fromCoarser.fillCurrentGhosts(hybridState.J, levelNumber, newTime);
     }
 
 
     {
         PHARE_LOG_SCOPE("SolverPPC::predictor2_.ohm");
 
-        auto& electrons = hybridState.electrons;
-        auto& Bpred     = electromagPred_.B;
-        auto& Epred     = electromagPred_.E;
-        auto& J         = hybridState.J;
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& electrons = thread.state.electrons;
+            auto& Bpred     = thread.electromagPred.B;
+            auto& Epred     = thread.electromagPred.E;
+            auto& J         = thread.state.J;
 
-        for (auto& patch : level)
-        {
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto _      = resourcesManager->setOnPatch(*patch, Bpred, Epred, J, electrons);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto _      = resourcesManager->setOnPatch(patch, Bpred, Epred, J, electrons);
             electrons.update(layout);
             auto& Ve = electrons.velocity();
             auto& Ne = electrons.density();
             auto& Pe = electrons.pressure();
-            auto __  = core::SetLayout(&layout, ohm_);
-            ohm_(Ne, Ve, Pe, Bpred, J, Epred);
-            resourcesManager->setTime(Epred, *patch, newTime);
-        }
+            auto __  = core::SetLayout(&layout, thread.ohm);
+            thread.ohm(Ne, Ve, Pe, Bpred, J, Epred);
+            resourcesManager->setTime(Epred, patch, newTime);
+        });
 
-        fromCoarser.fillElectricGhosts(Epred, levelNumber, newTime);
+        fromCoarser.fillElectricGhosts(electromagPred_.E, levelNumber, newTime);
     }
 }
 
@@ -449,20 +506,19 @@ void SolverPPC<HybridModel, AMR_Types>::corrector_(level_t& level, HybridModel&
     {
         PHARE_LOG_SCOPE("SolverPPC::corrector_.faraday");
 
-        auto& B    = hybridState.electromag.B;
-        auto& Eavg = electromagAvg_.E;
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& B    = thread.state.electromag.B;
+            auto& Eavg = thread.electromagAvg.E;
 
-        for (auto& patch : level)
-        {
-            auto _      = resourcesManager->setOnPatch(*patch, B, Eavg);
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto __     = core::SetLayout(&layout, faraday_);
-            faraday_(B, Eavg, B, dt);
+            auto _      = resourcesManager->setOnPatch(patch, B, Eavg);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto __     = core::SetLayout(&layout, thread.faraday);
+            thread.faraday(B, Eavg, B, dt);
 
-            resourcesManager->setTime(B, *patch, newTime);
-        }
+            resourcesManager->setTime(B, patch, newTime);
+        });
 
-        fromCoarser.fillMagneticGhosts(B, levelNumber, newTime);
+        fromCoarser.fillMagneticGhosts(hybridState.electromag.B, levelNumber, newTime);
     }
 
 
@@ -470,25 +526,24 @@ void SolverPPC<HybridModel, AMR_Types>::corrector_(level_t& level, HybridModel&
     {
         PHARE_LOG_SCOPE("SolverPPC::corrector_.ohm");
 
-        auto& electrons = hybridState.electrons;
-        auto& B         = hybridState.electromag.B;
-        auto& E         = hybridState.electromag.E;
-        auto& J         = hybridState.J;
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& electrons = thread.state.electrons;
+            auto& B         = thread.state.electromag.B;
+            auto& E         = thread.state.electromag.E;
+            auto& J         = thread.state.J;
 
-        for (auto& patch : level)
-        {
-            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-            auto _      = resourcesManager->setOnPatch(*patch, B, E, J, electrons);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            auto _      = resourcesManager->setOnPatch(patch, B, E, J, electrons);
             electrons.update(layout);
             auto& Ve = electrons.velocity();
             auto& Ne = electrons.density();
             auto& Pe = electrons.pressure();
-            auto __  = core::SetLayout(&layout, ohm_);
-            ohm_(Ne, Ve, Pe, B, J, E);
-            resourcesManager->setTime(E, *patch, newTime);
-        }
+            auto __  = core::SetLayout(&layout, thread.ohm);
+            thread.ohm(Ne, Ve, Pe, B, J, E);
+            resourcesManager->setTime(E, patch, newTime);
+        });
 
-        fromCoarser.fillElectricGhosts(E, levelNumber, newTime);
+        fromCoarser.fillElectricGhosts(hybridState.electromag.E, levelNumber, newTime);
     }
 }
 
@@ -499,35 +554,35 @@ void SolverPPC<HybridModel, AMR_Types>::average_(level_t& level, HybridModel& mo
 {
     PHARE_LOG_SCOPE("SolverPPC::average_");
 
-    auto& hybridState      = model.state;
     auto& resourcesManager = model.resourcesManager;
 
-    auto& Epred = electromagPred_.E;
-    auto& Bpred = electromagPred_.B;
-    auto& Bavg  = electromagAvg_.B;
-    auto& Eavg  = electromagAvg_.E;
-    auto& B     = hybridState.electromag.B;
-    auto& E     = hybridState.electromag.E;
+    forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+        auto& Epred = thread.electromagPred.E;
+        auto& Bpred = thread.electromagPred.B;
+        auto& Bavg  = thread.electromagAvg.B;
+        auto& Eavg  = thread.electromagAvg.E;
+        auto& B     = thread.state.electromag.B;
+        auto& E     = thread.state.electromag.E;
 
-    for (auto& patch : level)
-    {
-        auto _ = resourcesManager->setOnPatch(*patch, electromagAvg_, electromagPred_,
-                                              hybridState.electromag);
+        auto _ = resourcesManager->setOnPatch(patch, thread.electromagAvg, thread.electromagPred,
+                                              thread.state.electromag);
         PHARE::core::average(B, Bpred, Bavg);
         PHARE::core::average(E, Epred, Eavg);
-    }
+    });
 }
 
 
 
 template<typename HybridModel, typename AMR_Types>
-void SolverPPC<HybridModel, AMR_Types>::moveIons_(level_t& level, Ions& ions,
-                                                  Electromag& electromag, ResourcesManager& rm,
+void SolverPPC<HybridModel, AMR_Types>::moveIons_(level_t& level, HybridModel& model,
                                                   Messenger& fromCoarser, double const currentTime,
                                                   double const newTime, core::UpdaterMode mode)
 {
     PHARE_LOG_SCOPE("SolverPPC::moveIons_");
 
+    auto& ions = model.state.ions;
+    auto& rm   = *model.resourcesManager;
+
     std::size_t nbrDomainParticles        = 0;
     std::size_t nbrPatchGhostParticles    = 0;
     std::size_t nbrLevelGhostNewParticles = 0;
@@ -557,32 +612,133 @@ void SolverPPC<HybridModel, AMR_Types>::moveIons_(level_t& level, Ions& ions,
 
 
 
+    if (mode == core::UpdaterMode::domain_only or bulkPush_)
+        for (auto& patch : level)
+        {
+            auto const localId = static_cast<std::size_t>(patch->getLocalId().getValue());
+            if (localId >= timeNParticles_.size())
+                timeNParticles_.resize(localId + 1);
+        }
+
+
     auto dt = newTime - currentTime;
 
-    for (auto& patch : level)
-    {
-        auto _ = rm.setOnPatch(*patch, electromag, ions);
+    // time steps are constant on a level, so this counts the steps of the level
+    auto const step = static_cast<std::size_t>(std::round(newTime / dt));
 
-        auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-        ionUpdater_.updatePopulations(ions, electromag, layout, dt, mode);
+    auto timeNOf = [&](auto& patch) -> auto& {
+        return timeNParticles_[static_cast<std::size_t>(patch.getLocalId().getValue())];
+    };
 
-        // this needs to be done before calling the messenger
-        rm.setTime(ions, *patch, newTime);
+    // the bulk particles must not reach the ghost box of a neighbour patch while they are
+    // pushed apart from the exchange, the level is pushed in one phase if any may cross a cell
+    bool splitPush = bulkPush_ != nullptr;
+    if (splitPush)
+    {
+        std::atomic<bool> crossesACell{false};
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& threadIons = thread.state.ions;
+
+            auto _      = rm.setOnPatch(patch, thread.electromagAvg, threadIons);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            if (thread.ionUpdater.maxCellCrossing(threadIons, thread.electromagAvg, layout, dt)
+                >= 1)
+                crossesACell = true;
+        });
+        splitPush = !crossesACell;
+    }
+
+    if (splitPush)
+    {
+        // only particles close enough to the patch border to be exchanged are pushed before
+        // the messenger is called, the bulk of the particles is pushed while it exchanges
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& threadIons = thread.state.ions;
+
+            auto _      = rm.setOnPatch(patch, thread.electromagAvg, threadIons);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            thread.ionUpdater.updateBorder(threadIons, thread.electromagAvg, layout, dt, mode,
+                                           timeNOf(patch));
+
+            // this needs to be done before calling the messenger
+            rm.setTime(threadIons, patch, newTime);
+        });
+
+        // the bulk push only touches the particles set aside and the moments, and SAMRAI
+        // schedules are blocking, so it runs on another thread while this one exchanges
+        bulkPush_->push([&]() {
+            forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+                auto& threadIons = thread.state.ions;
+
+                auto _      = rm.setOnPatch(patch, thread.electromagAvg, threadIons);
+                auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+                thread.ionUpdater.updateBulk(threadIons, thread.electromagAvg, layout, dt, mode,
+                                             timeNOf(patch));
+            });
+        });
+
+        std::exception_ptr fillError;
+        try
+        {
+            fromCoarser.fillIonGhostParticles(ions, level, newTime);
+        }
+        catch (...)
+        {
+            fillError = std::current_exception();
+        }
+        // the bulk push refers to this frame, it must be over whatever happened
+        bulkPush_->wait();
+        if (fillError)
+            std::rethrow_exception(fillError);
     }
+    else
+    {
+        forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+            auto& threadIons = thread.state.ions;
+            auto& electromag = thread.electromagAvg;
+            auto& ionUpdater = thread.ionUpdater;
+            bool const sort  = mode == core::UpdaterMode::all and ionUpdater.sortIsDue(step);
+
+            auto _ = rm.setOnPatch(patch, electromag, threadIons);
+
+            auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+            ionUpdater.updatePopulations(threadIons, electromag, layout, dt, mode);
+
+            if (sort)
+                ionUpdater.sortPopulations(threadIons, layout);
 
+            if (mode == core::UpdaterMode::domain_only)
+                ionUpdater.setAside(threadIons, timeNOf(patch));
+
+            // this needs to be done before calling the messenger
+            rm.setTime(threadIons, patch, newTime);
+        });
+
+        fromCoarser.fillIonGhostParticles(ions, level, newTime);
+    }
 
-    fromCoarser.fillIonGhostParticles(ions, level, newTime);
     fromCoarser.fillIonMomentGhosts(ions, level, currentTime, newTime);
 
-    for (auto& patch : level)
-    {
-        auto _      = rm.setOnPatch(*patch, electromag, ions);
-        auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
-        ionUpdater_.updateIons(ions, layout);
+    forEachPatch_(level, model, [&](auto& patch, auto& thread) {
+        auto& threadIons = thread.state.ions;
+        auto& ionUpdater = thread.ionUpdater;
+
+        auto _      = rm.setOnPatch(patch, thread.electromagAvg, threadIons);
+        auto layout = PHARE::amr::layoutFromPatch<GridLayout>(patch);
+
+        if (splitPush and mode == core::UpdaterMode::all)
+        {
+            ionUpdater.mergeBulk(threadIons, timeNOf(patch));
+            if (ionUpdater.sortIsDue(step))
+                ionUpdater.sortPopulations(threadIons, layout);
+        }
+
+        ionUpdater.updateIons(threadIons, layout);
 
         // no need to update time, since it has been done before
-    }
+    });
 }
+
 } // namespace PHARE::solver
 
 
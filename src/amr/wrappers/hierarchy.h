@@ -17,13 +17,27 @@
 #include <SAMRAI/tbox/DatabaseBox.h>
 #include <SAMRAI/tbox/InputManager.h>
 #include <SAMRAI/tbox/MemoryDatabase.h>
+#include <SAMRAI/tbox/RestartManager.h>
 
 
 #include "initializer/data_provider.h"
+#include "core/utilities/mpi_utils.h"
+#include "amr/wrappers/restart_state.h"
 #include "core/utilities/point/point.h"
 
 namespace PHARE::amr
 {
+/**
+ * @brief isRestarting returns true if the simulation starts from a restart file rather than
+ * from the initial conditions
+ */
+inline bool isRestarting(PHARE::initializer::PHAREDict const& simDict)
+{
+    return simDict.contains("restarts") and simDict["restarts"].contains("restart_index");
+}
+
+
+
 /**
  * @brief The Hierarchy class is a wrapper of the SAMRAI hierarchy
  * so that users do not have to use SAMRAI types
@@ -121,6 +135,22 @@ inline auto Hierarchy::make()
     PHARE::initializer::PHAREDict const& theDict
         = PHARE::initializer::PHAREDictHandler::INSTANCE().dict();
     auto dim = theDict["simulation"]["dimension"].template to<int>();
+
+    // SAMRAI objects registered for restart, starting with the hierarchy, read their state from
+    // the restart file if it is open when they are constructed. It is closed once the
+    // simulator is initialized. Restart files written by a different number of ranks are not
+    // read by SAMRAI, see RestartState.
+    if (isRestarting(theDict["simulation"]))
+    {
+        auto const& restarts = theDict["simulation"]["restarts"];
+        auto const dir       = restarts["dir"].template to<std::string>();
+        auto const index     = restarts["restart_index"].template to<int>();
+
+        if (restartRanks(dir, index) == core::mpi::size())
+            SAMRAI::tbox::RestartManager::getManager()->openRestartFile(dir, index,
+                                                                        core::mpi::size());
+    }
+
     return core::makeAtRuntime<HierarchyMaker>(dim, HierarchyMaker{theDict});
 }
 
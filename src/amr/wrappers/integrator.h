@@ -33,15 +33,33 @@ public:
 
     void initialize() { timeRefIntegrator_->initializeHierarchy(); }
 
+    /** time and number of coarsest level steps of the hierarchy, which are not those of the
+     * start of the integration when restarting
+     */
+    double currentTime() const { return timeRefIntegrator_->getIntegratorTime(); }
+    int currentStep() const { return startStep_ + timeRefIntegrator_->getIntegratorStep(); }
+
+    /** redistributes the patches of the coarsest level among ranks with the load balancer,
+     * keeping its boxes. Finer levels are only rebalanced when they are regridded, the levels
+     * they communicate with must then be registered again to their messengers, see
+     * MultiPhysicsIntegrator::registerFinerLevels()
+     */
+    void rebalanceCoarsestLevel(double time) { gridding_->makeCoarsestLevel(time); }
+
 
     Integrator(PHARE::initializer::PHAREDict const& dict,
                std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy,
                std::shared_ptr<SAMRAI::algs::TimeRefinementLevelStrategy> timeRefLevelStrategy,
                std::shared_ptr<SAMRAI::mesh::StandardTagAndInitStrategy> tagAndInitStrategy,
-               double startTime, double endTime);
+               double startTime, double endTime, int workloadDataId = -1, int startStep = 0);
 
 private:
+    std::shared_ptr<SAMRAI::mesh::GriddingAlgorithm> gridding_;
     std::shared_ptr<SAMRAI::algs::TimeRefinementIntegrator> timeRefIntegrator_;
+
+    // steps done before a restart that the TimeRefinementIntegrator does not read back from
+    // restart files, when restarting on a different number of ranks
+    int startStep_ = 0;
 };
 
 
@@ -65,11 +83,16 @@ Integrator<_dimension>::Integrator(
     std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy,
     std::shared_ptr<SAMRAI::algs::TimeRefinementLevelStrategy> timeRefLevelStrategy,
     std::shared_ptr<SAMRAI::mesh::StandardTagAndInitStrategy> tagAndInitStrategy, double startTime,
-    double endTime)
+    double endTime, int workloadDataId, int startStep)
+    : startStep_{startStep}
 {
     auto loadBalancer = std::make_shared<SAMRAI::mesh::TreeLoadBalancer>(
         SAMRAI::tbox::Dimension{dimension}, "LoadBalancer");
 
+    // without workload data, the load balancer balances the number of cells
+    if (workloadDataId >= 0)
+        loadBalancer->setWorkloadPatchDataIndex(workloadDataId);
+
     auto refineDB    = getUserRefinementBoxesDatabase<dimension>(dict["simulation"]["AMR"]);
     auto standardTag = std::make_shared<SAMRAI::mesh::StandardTagAndInitialize>(
         "StandardTagAndInitialize", tagAndInitStrategy.get(), refineDB);
@@ -78,7 +101,7 @@ Integrator<_dimension>::Integrator(
     auto clustering
         = std::make_shared<SAMRAI::mesh::BergerRigoutsos>(SAMRAI::tbox::Dimension{dimension});
 
-    auto gridding = std::make_shared<SAMRAI::mesh::GriddingAlgorithm>(
+    gridding_ = std::make_shared<SAMRAI::mesh::GriddingAlgorithm>(
         hierarchy, "GriddingAlgorithm", std::shared_ptr<SAMRAI::tbox::Database>{}, standardTag,
         clustering, loadBalancer);
 
@@ -93,7 +116,7 @@ Integrator<_dimension>::Integrator(
 
 
     timeRefIntegrator_ = std::make_shared<SAMRAI::algs::TimeRefinementIntegrator>(
-        "TimeRefinementIntegrator", db, hierarchy, timeRefLevelStrategy, gridding);
+        "TimeRefinementIntegrator", db, hierarchy, timeRefLevelStrategy, gridding_);
 }
 
 
@@ -0,0 +1,375 @@
+#ifndef PHARE_AMR_RESTART_STATE_H
+#define PHARE_AMR_RESTART_STATE_H
+
+#include <SAMRAI/hier/Box.h>
+#include <SAMRAI/hier/BoxContainer.h>
+#include <SAMRAI/hier/BoxLevel.h>
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/hier/PatchHierarchy.h>
+#include <SAMRAI/hier/PatchLevel.h>
+#include <SAMRAI/hier/VariableDatabase.h>
+#include <SAMRAI/tbox/Database.h>
+#include <SAMRAI/tbox/DatabaseBox.h>
+#include <SAMRAI/tbox/HDFDatabase.h>
+#include <SAMRAI/tbox/RestartManager.h>
+#include <SAMRAI/tbox/Serializable.h>
+
+#include "core/utilities/mpi_utils.h"
+#include "initializer/data_provider.h"
+
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace PHARE::amr
+{
+/**
+ * @brief restartFilesDir is the directory in which nbrRanks ranks write their restart file
+ * for restartIndex, as laid out by the SAMRAI RestartManager
+ */
+inline std::string restartFilesDir(std::string const& dir, int restartIndex, int nbrRanks)
+{
+    std::stringstream ss;
+    ss << dir << "/restore." << std::setfill('0') << std::setw(6) << restartIndex << "/nodes."
+       << std::setw(7) << nbrRanks;
+    return ss.str();
+}
+
+
+
+inline std::string restartFile(std::string const& dir, int restartIndex, int nbrRanks, int rank)
+{
+    std::stringstream ss;
+    ss << restartFilesDir(dir, restartIndex, nbrRanks) << "/proc." << std::setfill('0')
+       << std::setw(7) << rank;
+    return ss.str();
+}
+
+
+
+/**
+ * @brief restartRanks returns the number of ranks that wrote the restart files of restartIndex.
+ * It is the current number of ranks whenever they wrote some, since SAMRAI can then read them.
+ */
+inline int restartRanks(std::string const& dir, int restartIndex)
+{
+    auto const nbrRanks = core::mpi::size();
+    if (std::filesystem::exists(restartFilesDir(dir, restartIndex, nbrRanks)))
+        return nbrRanks;
+
+    auto const restoreDir
+        = std::filesystem::path{restartFilesDir(dir, restartIndex, nbrRanks)}.parent_path();
+    std::string const prefix = "nodes.";
+
+    if (std::filesystem::exists(restoreDir))
+        for (auto const& entry : std::filesystem::directory_iterator{restoreDir})
+        {
+            auto const name = entry.path().filename().string();
+            if (name.rfind(prefix, 0) == 0)
+                return std::stoi(name.substr(prefix.size()));
+        }
+
+    throw std::runtime_error("Error - no restart files in " + restoreDir.string());
+}
+
+
+
+
+/**
+ * @brief RestartState writes to restart files the patch data a simulation resumes from, and
+ * reads them back when it restarts. Other patch data, like solver and messenger temporaries,
+ * are allocated again when restarting.
+ *
+ * The hierarchy and the time integrator write their own state through the SAMRAI
+ * RestartManager, which reads it back on as many ranks as wrote it. Patch data are then read
+ * back on the patches they were written from, see restore().
+ *
+ * On a different number of ranks, the patches written by rank i are read by rank
+ * i % nbrRanks, into levels that are not in the hierarchy. The hierarchy is made again at
+ * the restart time and each of its levels takes its data from the matching restarted level,
+ * as when it is regridded, see restartedLevel().
+ */
+class RestartState : public SAMRAI::tbox::Serializable
+{
+public:
+    RestartState(PHARE::initializer::PHAREDict const& simDict,
+                 std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy,
+                 std::vector<int> patchDataIds)
+        : hierarchy_{std::move(hierarchy)}
+        , patchDataIds_{std::move(patchDataIds)}
+    {
+        SAMRAI::tbox::RestartManager::getManager()->registerRestartItem(objectName, this);
+
+        auto const& restarts = simDict["restarts"];
+        if (!restarts.contains("restart_index"))
+            return;
+
+        auto const dir   = restarts["dir"].template to<std::string>();
+        auto const index = restarts["restart_index"].template to<int>();
+        auto const ranks = restartRanks(dir, index);
+
+        if (ranks == core::mpi::size())
+        {
+            // the RestartManager has opened the file of this rank, see Hierarchy::make()
+            restoresHierarchy_ = true;
+            readTimes_(*restartDatabase_());
+        }
+        else
+            readLevels_(dir, index, ranks);
+    }
+
+
+    ~RestartState() override
+    {
+        SAMRAI::tbox::RestartManager::getManager()->unregisterRestartItem(objectName);
+    }
+
+
+
+    /**
+     * @brief write writes the restart files of the simulation at the given step, in
+     * dir/restore.<step>, with one file per rank
+     */
+    void write(std::string const& dir, int step)
+    {
+        step_ = step;
+        SAMRAI::tbox::RestartManager::getManager()->writeRestartFile(dir, step);
+    }
+
+
+
+    void putToRestart(std::shared_ptr<SAMRAI::tbox::Database> const& restart_db) const override
+    {
+        auto const nbrLevels = hierarchy_->getNumberOfLevels();
+
+        restart_db->putInteger("step", step_);
+        restart_db->putDouble("time", hierarchy_->getPatchLevel(0)->getTime());
+        restart_db->putInteger("nbr_levels", nbrLevels);
+
+        for (int iLevel = 0; iLevel < nbrLevels; ++iLevel)
+        {
+            auto const& level = *hierarchy_->getPatchLevel(iLevel);
+            auto levelDb      = restart_db->putDatabase(levelKey_(iLevel));
+            auto const& ratio = level.getRatioToLevelZero();
+
+            std::vector<int> ratioToLevelZero(ratio.getDim().getValue());
+            for (std::size_t iDim = 0; iDim < ratioToLevelZero.size(); ++iDim)
+                ratioToLevelZero[iDim] = ratio[iDim];
+
+            levelDb->putIntegerVector("ratio_to_level_zero", ratioToLevelZero);
+            levelDb->putInteger("nbr_patches", level.getLocalNumberOfPatches());
+
+            int iPatch = 0;
+            for (auto const& patch : level)
+            {
+                auto patchDb = levelDb->putDatabase(patchKey_(iPatch++));
+                patchDb->putDatabaseBox("box", patch->getBox());
+
+                for (auto const id : patchDataIds_)
+                    patch->getPatchData(id)->putToRestart(
+                        patchDb->putDatabase(patchDataName_(id)));
+            }
+        }
+    }
+
+
+
+    //! true if SAMRAI has read the hierarchy back from the restart files
+    bool restoresHierarchy() const { return restoresHierarchy_; }
+
+    //! time and number of coarsest level steps the simulation restarts from
+    double restartTime() const { return time_; }
+    int restartStep() const { return step_; }
+
+
+
+    /**
+     * @brief restore reads back the patch data of a level SAMRAI has read from the restart
+     * files. Patches are found by their box since their order on the level may differ from
+     * the one they were written in.
+     */
+    void restore(SAMRAI::hier::PatchLevel& level) const
+    {
+        auto levelDb    = restartDatabase_()->getDatabase(levelKey_(level.getLevelNumber()));
+        auto nbrPatches = levelDb->getInteger("nbr_patches");
+
+        for (auto& patch : level)
+        {
+            auto patchDb = findPatch_(*levelDb, nbrPatches, patch->getBox());
+            for (auto const id : patchDataIds_)
+                patch->getPatchData(id)->getFromRestart(patchDb->getDatabase(patchDataName_(id)));
+        }
+    }
+
+
+
+    /**
+     * @brief restartedLevel returns the level of the given number read from restart files
+     * written by a different number of ranks, or nullptr if there is none
+     */
+    std::shared_ptr<SAMRAI::hier::PatchLevel> restartedLevel(int levelNumber) const
+    {
+        if (levelNumber < static_cast<int>(restartedLevels_.size()))
+            return restartedLevels_[levelNumber];
+        return nullptr;
+    }
+
+
+
+    /**
+     * @brief close releases restarted data once the hierarchy has taken them
+     */
+    void close()
+    {
+        if (restoresHierarchy_)
+            SAMRAI::tbox::RestartManager::getManager()->closeRestartFile();
+
+        restartedLevels_.clear();
+        for (auto& file : files_)
+            file->close();
+        files_.clear();
+    }
+
+
+
+    static inline std::string const objectName = "PHARE_restart_state";
+
+private:
+    std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy_;
+    std::vector<int> patchDataIds_;
+    bool restoresHierarchy_ = false;
+    double time_            = 0;
+    int step_               = 0;
+    std::vector<std::shared_ptr<SAMRAI::hier::PatchLevel>> restartedLevels_;
+    std::vector<std::shared_ptr<SAMRAI::tbox::HDFDatabase>> files_;
+
+
+    static std::string levelKey_(int levelNumber) { return "level_" + std::to_string(levelNumber); }
+    static std::string patchKey_(int patchIndex) { return "patch_" + std::to_string(patchIndex); }
+
+    static std::string patchDataName_(int id)
+    {
+        return SAMRAI::hier::VariableDatabase::getDatabase()->getPatchDescriptor()->mapIndexToName(
+            id);
+    }
+
+
+    static std::shared_ptr<SAMRAI::tbox::Database> restartDatabase_()
+    {
+        return SAMRAI::tbox::RestartManager::getManager()->getRootDatabase()->getDatabase(
+            objectName);
+    }
+
+
+    void readTimes_(SAMRAI::tbox::Database& restartDb)
+    {
+        time_ = restartDb.getDouble("time");
+        step_ = restartDb.getInteger("step");
+    }
+
+
+    static std::shared_ptr<SAMRAI::tbox::Database>
+    findPatch_(SAMRAI::tbox::Database& levelDb, int nbrPatches, SAMRAI::hier::Box const& box)
+    {
+        SAMRAI::tbox::DatabaseBox const patchBox = box;
+        for (int iPatch = 0; iPatch < nbrPatches; ++iPatch)
+        {
+            auto patchDb = levelDb.getDatabase(patchKey_(iPatch));
+            if (patchDb->getDatabaseBox("box") == patchBox)
+                return patchDb;
+        }
+        throw std::runtime_error("Error - no restarted patch for box " + levelDb.getName());
+    }
+
+
+    std::shared_ptr<SAMRAI::tbox::Database> openFile_(std::string const& dir, int index,
+                                                      int nbrRanks, int rank)
+    {
+        auto file = std::make_shared<SAMRAI::tbox::HDFDatabase>("restart");
+        if (!file->open(restartFile(dir, index, nbrRanks, rank)))
+            throw std::runtime_error("Error - cannot open "
+                                     + restartFile(dir, index, nbrRanks, rank));
+        files_.push_back(file);
+        return file->getDatabase(objectName);
+    }
+
+
+    /**
+     * all ranks read the times and the levels layout from the file of rank 0, so that they make
+     * the same levels, and the patches of the files they take
+     */
+    void readLevels_(std::string const& dir, int index, int writtenRanks)
+    {
+        auto const rank     = core::mpi::rank();
+        auto const nbrRanks = core::mpi::size();
+        auto const dim      = hierarchy_->getDim();
+
+        auto rootDb = openFile_(dir, index, writtenRanks, 0);
+        readTimes_(*rootDb);
+
+        std::vector<std::shared_ptr<SAMRAI::tbox::Database>> restartDbs;
+        for (int writer = rank; writer < writtenRanks; writer += nbrRanks)
+            restartDbs.push_back(writer == 0 ? rootDb
+                                             : openFile_(dir, index, writtenRanks, writer));
+
+        auto const nbrLevels = rootDb->getInteger("nbr_levels");
+        for (int iLevel = 0; iLevel < nbrLevels; ++iLevel)
+        {
+            auto const ratioToLevelZero
+                = rootDb->getDatabase(levelKey_(iLevel))->getIntegerVector("ratio_to_level_zero");
+            SAMRAI::hier::IntVector ratio{dim};
+            for (std::size_t iDim = 0; iDim < ratioToLevelZero.size(); ++iDim)
+                ratio[iDim] = ratioToLevelZero[iDim];
+
+            // patches written on this level by the ranks this rank takes
+            std::vector<std::shared_ptr<SAMRAI::tbox::Database>> patchDbs;
+            SAMRAI::hier::BoxContainer boxes;
+            for (auto const& restartDb : restartDbs)
+            {
+                auto levelDb    = restartDb->getDatabase(levelKey_(iLevel));
+                auto nbrPatches = levelDb->getInteger("nbr_patches");
+                for (int iPatch = 0; iPatch < nbrPatches; ++iPatch)
+                {
+                    auto patchDb = levelDb->getDatabase(patchKey_(iPatch));
+                    SAMRAI::hier::Box box{patchDb->getDatabaseBox("box")};
+                    box.setBlockId(SAMRAI::hier::BlockId{0});
+                    box.setId(SAMRAI::hier::BoxId{SAMRAI::hier::GlobalId{
+                        SAMRAI::hier::LocalId{static_cast<int>(patchDbs.size())}, rank}});
+                    boxes.push_back(box);
+                    patchDbs.push_back(patchDb);
+                }
+            }
+
+            SAMRAI::hier::BoxLevel boxLevel{boxes, ratio, hierarchy_->getGridGeometry()};
+            auto level = std::make_shared<SAMRAI::hier::PatchLevel>(
+                boxLevel, hierarchy_->getGridGeometry(),
+                SAMRAI::hier::VariableDatabase::getDatabase()->getPatchDescriptor());
+            level->setLevelNumber(iLevel);
+
+            for (auto const id : patchDataIds_)
+                level->allocatePatchData(id, time_);
+
+            for (auto& patch : *level)
+            {
+                auto patchDb = patchDbs[patch->getLocalId().getValue()];
+                for (auto const id : patchDataIds_)
+                    patch->getPatchData(id)->getFromRestart(
+                        patchDb->getDatabase(patchDataName_(id)));
+            }
+            level->setTime(time_);
+
+            restartedLevels_.push_back(level);
+        }
+    }
+};
+
+} // namespace PHARE::amr
+
+
+#endif
@@ -91,6 +91,20 @@ namespace core
 
 
 
+        ParticleArray const& domainParticles() const
+        {
+            if (isUsable())
+            {
+                return *particles_->domainParticles;
+            }
+            else
+            {
+                throw std::runtime_error("Error - cannot provide access to particle buffers");
+            }
+        }
+
+
+
         ParticleArray& patchGhostParticles()
         {
             if (isUsable())
@@ -173,6 +187,9 @@ namespace core
         VecField& flux() { return flux_; }
 
 
+        std::string densityName() const { return name_ + "_rho"; }
+
+
 
         //-------------------------------------------------------------------------
         //                  start the ResourcesUser interface
@@ -192,7 +209,7 @@ namespace core
 
         MomentProperties getFieldNamesAndQuantities() const
         {
-            return {{{name_ + "_rho", HybridQuantity::Scalar::rho}}};
+            return {{{densityName(), HybridQuantity::Scalar::rho}}};
         }
 
 
@@ -224,7 +241,7 @@ namespace core
 
         void setBuffer(std::string const& bufferName, field_type* field)
         {
-            if (bufferName == name_ + "_rho")
+            if (bufferName == densityName())
             {
                 rho_ = field;
             }
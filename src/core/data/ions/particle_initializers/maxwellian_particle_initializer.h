@@ -3,7 +3,10 @@
 
 #include <memory>
 #include <random>
+#include <string>
 #include <cassert>
+#include <cstdint>
+#include <algorithm>
 #include <functional>
 
 #include "core/data/grid/gridlayoutdefs.h"
@@ -12,13 +15,25 @@
 #include "core/data/ions/particle_initializers/particle_initializer.h"
 #include "core/data/particles/particle.h"
 #include "initializer/data_provider.h"
+#include "core/utilities/philox.h"
 #include "core/utilities/point/point.h"
+#include "core/utilities/thread_pool.h"
 
 
 namespace PHARE::core
 {
-void maxwellianVelocity(std::array<double, 3> V, std::array<double, 3> Vth,
-                        std::mt19937_64& generator, std::array<double, 3>& partVelocity);
+template<typename Generator>
+void maxwellianVelocity(std::array<double, 3> V, std::array<double, 3> Vth, Generator& generator,
+                        std::array<double, 3>& partVelocity)
+{
+    std::normal_distribution<> maxwellX(V[0], Vth[0]);
+    std::normal_distribution<> maxwellY(V[1], Vth[1]);
+    std::normal_distribution<> maxwellZ(V[2], Vth[2]);
+
+    partVelocity[0] = maxwellX(generator);
+    partVelocity[1] = maxwellY(generator);
+    partVelocity[2] = maxwellZ(generator);
+}
 
 
 std::array<double, 3> basisTransform(std::array<std::array<double, 3>, 3> const& basis,
@@ -29,6 +44,16 @@ void localMagneticBasis(std::array<double, 3> B, std::array<std::array<double, 3
 
 /** @brief a MaxwellianParticleInitializer is a ParticleInitializer that loads particles from a
  * local Maxwellian distribution given density, bulk velocity and thermal velocity profiles.
+ *
+ * The profiles are evaluated once per patch, on the coordinates of all its cells. The cells are
+ * then filled by blocks of cells_per_block cells, shared among the threads of the given pool.
+ * The pool is owned by the caller, so that the initializers of all patches and populations use
+ * the same threads.
+ *
+ * The random numbers of a particle are drawn from a Philox4x32 stream keyed by the seed and the
+ * population, and identified by the level, the AMR index of the cell and the index of the
+ * particle in the cell. A seeded initializer therefore loads the same particles in a cell
+ * whatever the patches, the MPI processes and the threads.
  */
 template<typename ParticleArray, typename GridLayout>
 class MaxwellianParticleInitializer : public ParticleInitializer<ParticleArray, GridLayout>
@@ -43,7 +68,9 @@ public:
                                   std::optional<std::size_t> seed = {},
                                   Basis basis                     = Basis::Cartesian,
                                   std::array<InputFunction, 3> magneticField
-                                  = {nullptr, nullptr, nullptr})
+                                  = {nullptr, nullptr, nullptr},
+                                  ThreadPool& threadPool        = ThreadPool::serial(),
+                                  std::string const& population = "")
         : density_{density}
         , bulkVelocity_{bulkVelocity}
         , thermalVelocity_{thermalVelocity}
@@ -52,13 +79,14 @@ public:
         , nbrParticlePerCell_{nbrParticlesPerCell}
         , basis_{basis}
         , rngSeed_{seed}
+        , threadPool_{threadPool}
+        , populationKey_{Philox4x32::mix(0, population)}
     {
     }
 
 
     /**
-     * @brief load pacore
-} // namespace PHARErticles in a ParticleArray in a domain defined by the given layout
+     * @brief load particles in a ParticleArray in a domain defined by the given layout
      */
     void loadParticles(ParticleArray& particles, GridLayout const& layout) const override;
 
@@ -78,6 +106,8 @@ public:
         return std::mt19937_64(*seed);
     }
 
+    static constexpr std::size_t cells_per_block = 64;
+
 private:
     using Particle = typename ParticleArray::value_type;
     InputFunction density_;
@@ -89,6 +119,8 @@ private:
     std::uint32_t nbrParticlePerCell_;
     Basis basis_;
     std::optional<std::size_t> rngSeed_;
+    ThreadPool& threadPool_;
+    std::uint64_t populationKey_;
 };
 
 
@@ -171,37 +203,70 @@ void MaxwellianParticleInitializer<ParticleArray, GridLayout>::loadParticles(
         cellCoords));
 
     auto const [n, V, Vth] = fns();
-    auto randGen           = getRNG(rngSeed_);
-    ParticleDeltaDistribution<double> deltaDistrib;
 
-    for (std::size_t flatCellIdx = 0; flatCellIdx < ndCellIndices.size(); flatCellIdx++)
-    {
-        auto const cellWeight   = n[flatCellIdx] / nbrParticlePerCell_;
-        auto const AMRCellIndex = layout.localToAMR(point(flatCellIdx, ndCellIndices));
+    // particles are written in place, the array holds exactly those of the patch after resize
+    auto const nbrCells      = ndCellIndices.size();
+    auto const firstParticle = particles.size();
+    particles.resize(firstParticle + nbrCells * nbrParticlePerCell_);
 
-        std::array<double, 3> particleVelocity;
-        std::array<std::array<double, 3>, 3> basis;
+    auto const seed = rngSeed_ ? *rngSeed_ : std::size_t{getRNG(rngSeed_)()};
+    auto const key  = Philox4x32::key(Philox4x32::mix(Philox4x32::mix(seed) ^ populationKey_));
 
-        if (basis_ == Basis::Magnetic)
-        {
-            auto const B = fns.B();
-            localMagneticBasis({B[0][flatCellIdx], B[1][flatCellIdx], B[2][flatCellIdx]}, basis);
-        }
+    // AMR indexes are those of the level, of which the mesh size tells the cells apart
+    auto levelKey = std::uint64_t{0};
+    for (auto dl : layout.meshSize())
+        levelKey = Philox4x32::mix(levelKey, dl);
 
-        for (std::uint32_t ipart = 0; ipart < nbrParticlePerCell_; ++ipart)
+    auto cellKey = [&](auto const& iCell) {
+        auto hash = levelKey;
+        for (auto i : iCell)
+            hash = Philox4x32::mix(hash ^ static_cast<std::uint32_t>(i));
+        return hash;
+    };
+
+    auto loadBlock = [&](std::size_t block, std::size_t /*threadIdx*/) {
+        ParticleDeltaDistribution<double> deltaDistrib;
+
+        auto const endCellIdx = std::min(nbrCells, (block + 1) * cells_per_block);
+        for (auto flatCellIdx = block * cells_per_block; flatCellIdx < endCellIdx; flatCellIdx++)
         {
-            maxwellianVelocity({V[0][flatCellIdx], V[1][flatCellIdx], V[2][flatCellIdx]},
-                               {Vth[0][flatCellIdx], Vth[1][flatCellIdx], Vth[2][flatCellIdx]}, //
-                               randGen, particleVelocity);
+            auto const cellWeight   = n[flatCellIdx] / nbrParticlePerCell_;
+            auto const AMRCellIndex = layout.localToAMR(point(flatCellIdx, ndCellIndices));
+            auto const iCell        = AMRCellIndex.template toArray<int>();
+            auto const cellHash     = cellKey(iCell);
 
-            if (basis_ == Basis::Magnetic)
-                particleVelocity = basisTransform(basis, particleVelocity);
+            std::array<double, 3> particleVelocity;
+            std::array<std::array<double, 3>, 3> basis;
 
-            particles.emplace_back(Particle{cellWeight, particleCharge_,
-                                            AMRCellIndex.template toArray<int>(),
-                                            deltas(deltaDistrib, randGen), particleVelocity});
+            if (basis_ == Basis::Magnetic)
+            {
+                auto const B = fns.B();
+                localMagneticBasis({B[0][flatCellIdx], B[1][flatCellIdx], B[2][flatCellIdx]},
+                                   basis);
+            }
+
+            auto iPart = firstParticle + flatCellIdx * nbrParticlePerCell_;
+            for (std::uint32_t ipart = 0; ipart < nbrParticlePerCell_; ++ipart, ++iPart)
+            {
+                Philox4x32 randGen{key, {static_cast<std::uint32_t>(cellHash),
+                                         static_cast<std::uint32_t>(cellHash >> 32), ipart}};
+
+                maxwellianVelocity({V[0][flatCellIdx], V[1][flatCellIdx], V[2][flatCellIdx]},
+                                   {Vth[0][flatCellIdx], Vth[1][flatCellIdx],
+                                    Vth[2][flatCellIdx]}, //
+                                   randGen, particleVelocity);
+
+                if (basis_ == Basis::Magnetic)
+                    particleVelocity = basisTransform(basis, particleVelocity);
+
+                particles[iPart] = Particle{cellWeight, particleCharge_, iCell,
+                                            deltas(deltaDistrib, randGen), particleVelocity};
+            }
         }
-    }
+    };
+
+    auto const nbrBlocks = (nbrCells + cells_per_block - 1) / cells_per_block;
+    threadPool_.parallel_for(nbrBlocks, loadBlock);
 }
 
 } // namespace PHARE::core
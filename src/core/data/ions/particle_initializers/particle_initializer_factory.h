@@ -2,12 +2,15 @@
 #define PHARE_PARTICLE_INITIALIZER_FACTORY_H
 
 
+#include "core/utilities/thread_pool.h"
 #include "core/utilities/types.h"
 #include "initializer/data_provider.h"
 #include "maxwellian_particle_initializer.h"
 #include "particle_initializer.h"
 
 #include <memory>
+#include <stdexcept>
+#include <string>
 
 namespace PHARE
 {
@@ -21,7 +24,11 @@ namespace core
 
 
     public:
-        static std::unique_ptr<ParticleInitializerT> create(initializer::PHAREDict const& dict)
+        /** threadPool loads the particles of a patch, it is owned by the caller so that the
+         * initializers of all patches and populations share it
+         */
+        static std::unique_ptr<ParticleInitializerT>
+        create(initializer::PHAREDict const& dict, ThreadPool& threadPool = ThreadPool::serial())
         {
             using FunctionType = initializer::InitFunction<dimension>;
 
@@ -57,23 +64,31 @@ namespace core
                 if (dict.contains("init") && dict["init"].contains("seed"))
                     seed = dict["init"]["seed"].template to<std::optional<std::size_t>>();
 
+                // keys the random streams, so that populations of the same seed differ
+                std::string population;
+                if (dict.contains("population"))
+                    population = dict["population"].template to<std::string>();
+
                 if (basisName == "cartesian")
                 {
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
-                        density, v, vth, charge, nbrPartPerCell, seed);
+                        density, v, vth, charge, nbrPartPerCell, seed, Basis::Cartesian,
+                        std::array<FunctionType, 3>{nullptr, nullptr, nullptr}, threadPool,
+                        population);
                 }
                 else if (basisName == "magnetic")
                 {
-                    [[maybe_unused]] Basis basis = Basis::Magnetic;
-                    [[maybe_unused]] auto& bx    = dict["magnetic_x"].template to<FunctionType>();
-                    [[maybe_unused]] auto& by    = dict["magnetic_x"].template to<FunctionType>();
-                    [[maybe_unused]] auto& bz    = dict["magnetic_x"].template to<FunctionType>();
+                    auto& bx = dict["magnetic_x"].template to<FunctionType>();
+                    auto& by = dict["magnetic_y"].template to<FunctionType>();
+                    auto& bz = dict["magnetic_z"].template to<FunctionType>();
 
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
-                        density, v, vth, charge, nbrPartPerCell, seed);
+                        density, v, vth, charge, nbrPartPerCell, seed, Basis::Magnetic,
+                        std::array<FunctionType, 3>{bx, by, bz}, threadPool, population);
                 }
+                throw std::runtime_error("unknown particle initializer basis: " + basisName);
             }
             // TODO throw?
             return nullptr;
@@ -48,22 +48,13 @@ struct Particle
     std::array<double, dim> delta = ConstArray<double, dim>();
     std::array<double, 3> v       = ConstArray<double, 3>();
 
-    double Ex = 0, Ey = 0, Ez = 0;
-    double Bx = 0, By = 0, Bz = 0;
-
     bool operator==(Particle<dim> const& that) const
     {
         return (this->weight == that.weight) && //
                (this->charge == that.charge) && //
                (this->iCell == that.iCell) &&   //
                (this->delta == that.delta) &&   //
-               (this->v == that.v) &&           //
-               (this->Ex == that.Ex) &&         //
-               (this->Ey == that.Ey) &&         //
-               (this->Ez == that.Ez) &&         //
-               (this->Bx == that.Bx) &&         //
-               (this->By == that.By) &&         //
-               (this->Bz == that.Bz);
+               (this->v == that.v);
     }
 };
 
@@ -79,20 +70,108 @@ struct ParticleView
     std::array<int, dim>& iCell;
     std::array<double, dim>& delta;
     std::array<double, 3>& v;
+
+    ParticleView(double& weight_, double& charge_, std::array<int, dim>& iCell_,
+                 std::array<double, dim>& delta_, std::array<double, 3>& v_)
+        : weight{weight_}
+        , charge{charge_}
+        , iCell{iCell_}
+        , delta{delta_}
+        , v{v_}
+    {
+    }
+    ParticleView(ParticleView const&) = default;
+
+    // a view is a proxy, assigning to it writes through to the viewed particle
+    ParticleView& operator=(ParticleView const& that) { return assign_(that); }
+    ParticleView& operator=(Particle<dim> const& that) { return assign_(that); }
+
+    operator Particle<dim>() const { return {weight, charge, iCell, delta, v}; }
+
+    friend void swap(ParticleView a, ParticleView b)
+    {
+        Particle<dim> tmp = a;
+        a                 = b;
+        b                 = tmp;
+    }
+
+private:
+    template<typename That>
+    ParticleView& assign_(That const& that)
+    {
+        weight = that.weight;
+        charge = that.charge;
+        iCell  = that.iCell;
+        delta  = that.delta;
+        v      = that.v;
+        return *this;
+    }
 };
 
 
 
+template<std::size_t dim>
+struct ConstParticleView
+{
+    static_assert(dim > 0 and dim < 4, "Only dimensions 1,2,3 are supported.");
+    static constexpr std::size_t dimension = dim;
+
+    double const& weight;
+    double const& charge;
+    std::array<int, dim> const& iCell;
+    std::array<double, dim> const& delta;
+    std::array<double, 3> const& v;
+
+    ConstParticleView(double const& weight_, double const& charge_,
+                      std::array<int, dim> const& iCell_, std::array<double, dim> const& delta_,
+                      std::array<double, 3> const& v_)
+        : weight{weight_}
+        , charge{charge_}
+        , iCell{iCell_}
+        , delta{delta_}
+        , v{v_}
+    {
+    }
+    ConstParticleView(ConstParticleView const&) = default;
+    ConstParticleView(ParticleView<dim> const& that)
+        : ConstParticleView{that.weight, that.charge, that.iCell, that.delta, that.v}
+    {
+    }
+
+    operator Particle<dim>() const { return {weight, charge, iCell, delta, v}; }
+};
+
+
+
+/** ContiguousParticles stores particles as a structure of arrays, one array per particle
+ * attribute, vector attributes being contiguous per particle (e.g. iCell = x0,y0,x1,y1...).
+ *
+ * In its owning state (OwnedState = true), it is a particle container exposing the same
+ * interface as ParticleArray, and can be used as particle_array_type of ion populations.
+ * Iterators are random access, their reference is a ParticleView proxy, or a ConstParticleView
+ * one for const iterators.
+ *
+ * In its non owning state, it is a view on externally allocated buffers (e.g. numpy arrays)
+ */
 template<std::size_t dim, bool OwnedState = true>
 struct ContiguousParticles
 {
     static constexpr bool is_contiguous    = true;
     static constexpr std::size_t dimension = dim;
     using ContiguousParticles_             = ContiguousParticles<dim, OwnedState>;
+    using Particle_t                       = Particle<dim>;
+    using value_type                       = Particle_t;
+    using view_type                        = ParticleView<dim>;
+    using const_view_type                  = ConstParticleView<dim>;
 
     template<typename T>
     using container_t = std::conditional_t<OwnedState, std::vector<T>, Span<T>>;
 
+    template<bool OS = OwnedState, typename = std::enable_if_t<OS>>
+    ContiguousParticles()
+    {
+    }
+
     template<bool OS = OwnedState, typename = std::enable_if_t<OS>>
     ContiguousParticles(std::size_t s)
         : iCell(s * dim)
@@ -103,6 +182,14 @@ struct ContiguousParticles
     {
     }
 
+    template<bool OS = OwnedState, typename = std::enable_if_t<OS>>
+    ContiguousParticles(std::size_t s, Particle_t const& particle)
+    {
+        reserve(s);
+        for (std::size_t i = 0; i < s; ++i)
+            push_back(particle);
+    }
+
     template<typename Container_int, typename Container_double>
     ContiguousParticles(Container_int&& _iCell, Container_double&& _delta,
                         Container_double&& _weight, Container_double&& _charge,
@@ -116,62 +203,272 @@ struct ContiguousParticles
     }
 
     std::size_t size() const { return weight.size(); }
+    std::size_t capacity() const { return weight.capacity(); }
 
+    // constness of the element type is kept, a const array of particles gives const views
     template<std::size_t S, typename T>
-    static std::array<T, S>* _array_cast(T const* array)
+    static auto _array_cast(T* array)
     {
-        return reinterpret_cast<std::array<T, S>*>(const_cast<T*>(array));
+        using Array = std::conditional_t<std::is_const_v<T>,
+                                         std::array<std::remove_const_t<T>, S> const,
+                                         std::array<T, S>>;
+        return reinterpret_cast<Array*>(array);
     }
 
-    template<typename Return>
-    Return _to(std::size_t i)
+    template<typename Return, typename Self>
+    static Return _to(Self& self, std::size_t i)
     {
         return {
-            *const_cast<double*>(weight.data() + i),     //
-            *const_cast<double*>(charge.data() + i),     //
-            *_array_cast<dim>(iCell.data() + (dim * i)), //
-            *_array_cast<dim>(delta.data() + (dim * i)), //
-            *_array_cast<3>(v.data() + (3 * i)),
+            *(data_(self.weight) + i),                        //
+            *(data_(self.charge) + i),                        //
+            *_array_cast<dim>(data_(self.iCell) + (dim * i)), //
+            *_array_cast<dim>(data_(self.delta) + (dim * i)), //
+            *_array_cast<3>(data_(self.v) + (3 * i)),
         };
     }
 
-    auto copy(std::size_t i) { return _to<Particle<dim>>(i); }
-    auto view(std::size_t i) { return _to<ParticleView<dim>>(i); }
+    auto copy(std::size_t i) const { return _to<Particle<dim>>(*this, i); }
+
+    view_type view(std::size_t i) { return _to<view_type>(*this, i); }
+    const_view_type view(std::size_t i) const { return _to<const_view_type>(*this, i); }
 
     auto operator[](std::size_t i) const { return view(i); }
     auto operator[](std::size_t i) { return view(i); }
 
-    struct iterator
+
+    template<bool is_const>
+    struct iterator_t
     {
-        iterator(ContiguousParticles_* particles)
+        using Particles_
+            = std::conditional_t<is_const, ContiguousParticles_ const, ContiguousParticles_>;
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = Particle<dim>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::conditional_t<is_const, const_view_type, view_type>;
+
+        // operator-> must return something that has an operator->, we keep the proxy alive
+        struct pointer
+        {
+            reference ref;
+            reference* operator->() { return &ref; }
+        };
+
+        iterator_t() = default;
+        iterator_t(Particles_* particles, std::size_t idx)
+            : particles_{particles}
+            , idx_{idx}
         {
-            for (std::size_t i = 0; i < particles->size(); i++)
-                views.emplace_back((*particles)[i]);
         }
 
-        iterator& operator++()
+        // an iterator converts to a const_iterator, not the other way around
+        template<bool c = is_const, typename = std::enable_if_t<c>>
+        iterator_t(iterator_t<false> const& that)
+            : particles_{that.particles_}
+            , idx_{that.idx_}
         {
-            ++curr_pos;
+        }
+
+        reference operator*() const { return particles_->view(idx_); }
+        pointer operator->() const { return {**this}; }
+        reference operator[](difference_type n) const { return particles_->view(idx_ + n); }
+
+        iterator_t& operator++()
+        {
+            ++idx_;
             return *this;
         }
+        iterator_t operator++(int)
+        {
+            auto copy = *this;
+            ++idx_;
+            return copy;
+        }
+        iterator_t& operator--()
+        {
+            --idx_;
+            return *this;
+        }
+        iterator_t operator--(int)
+        {
+            auto copy = *this;
+            --idx_;
+            return copy;
+        }
 
-        bool operator!=(iterator const& other) const { return curr_pos != views.size(); }
-        auto& operator*() { return views[curr_pos]; }
-        auto& operator*() const { return views[curr_pos]; }
+        iterator_t& operator+=(difference_type n)
+        {
+            idx_ += n;
+            return *this;
+        }
+        iterator_t& operator-=(difference_type n)
+        {
+            idx_ -= n;
+            return *this;
+        }
+        iterator_t operator+(difference_type n) const { return iterator_t{*this} += n; }
+        iterator_t operator-(difference_type n) const { return iterator_t{*this} -= n; }
+        friend iterator_t operator+(difference_type n, iterator_t const& it) { return it + n; }
 
-        std::size_t curr_pos = 0;
-        std::vector<ParticleView<dim>> views;
+        difference_type operator-(iterator_t const& that) const
+        {
+            return static_cast<difference_type>(idx_) - static_cast<difference_type>(that.idx_);
+        }
+
+        friend bool operator==(iterator_t a, iterator_t b) { return a.idx_ == b.idx_; }
+        friend bool operator!=(iterator_t a, iterator_t b) { return a.idx_ != b.idx_; }
+        friend bool operator<(iterator_t a, iterator_t b) { return a.idx_ < b.idx_; }
+        friend bool operator>(iterator_t a, iterator_t b) { return a.idx_ > b.idx_; }
+        friend bool operator<=(iterator_t a, iterator_t b) { return a.idx_ <= b.idx_; }
+        friend bool operator>=(iterator_t a, iterator_t b) { return a.idx_ >= b.idx_; }
+
+        std::size_t idx() const { return idx_; }
+
+    private:
+        template<bool>
+        friend struct iterator_t;
+
+        Particles_* particles_ = nullptr;
+        std::size_t idx_       = 0;
     };
 
-    auto begin() { return iterator(this); }
-    auto cbegin() const { return iterator(this); }
+    using iterator       = iterator_t<false>;
+    using const_iterator = iterator_t<true>;
+
+    auto begin() { return iterator(this, 0); }
+    auto end() { return iterator(this, size()); }
+
+    auto begin() const { return const_iterator(this, 0); }
+    auto end() const { return const_iterator(this, size()); }
+
+    auto cbegin() const { return begin(); }
+    auto cend() const { return end(); }
+
+
+
+    // below is the ParticleArray interface, only available in owning state
+
+    void clear()
+    {
+        for_each_container_([](auto& container, auto /*nbrPerParticle*/) { container.clear(); });
+    }
+
+    void reserve(std::size_t newSize)
+    {
+        for_each_container_([&](auto& container, auto nbrPerParticle) {
+            container.reserve(newSize * nbrPerParticle);
+        });
+    }
+
+    void resize(std::size_t newSize)
+    {
+        for_each_container_([&](auto& container, auto nbrPerParticle) {
+            container.resize(newSize * nbrPerParticle);
+        });
+    }
+
+    view_type back() { return view(size() - 1); }
+    view_type front() { return view(0); }
+
+    view_type emplace_back() { return emplace_back(Particle_t{}); }
+    view_type emplace_back(Particle_t&& particle)
+    {
+        push_back(particle);
+        return back();
+    }
+
+    void push_back(Particle_t&& particle) { push_back(static_cast<Particle_t const&>(particle)); }
+    void push_back(Particle_t const& particle)
+    {
+        weight.push_back(particle.weight);
+        charge.push_back(particle.charge);
+        iCell.insert(std::end(iCell), std::begin(particle.iCell), std::end(particle.iCell));
+        delta.insert(std::end(delta), std::begin(particle.delta), std::end(particle.delta));
+        v.insert(std::end(v), std::begin(particle.v), std::end(particle.v));
+    }
+
+    template<class InputIterator>
+    void insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        ContiguousParticles_ inserted;
+        for (; first != last; ++first)
+            inserted.push_back(*first);
+
+        auto const at = position.idx();
+        insert_(iCell, inserted.iCell, at * dim);
+        insert_(delta, inserted.delta, at * dim);
+        insert_(weight, inserted.weight, at);
+        insert_(charge, inserted.charge, at);
+        insert_(v, inserted.v, at * 3);
+    }
+
+    iterator erase(const_iterator position) { return erase(position, position + 1); }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto const from = first.idx(), to = last.idx();
+        for_each_container_([&](auto& container, auto nbrPerParticle) {
+            container.erase(std::begin(container) + from * nbrPerParticle,
+                            std::begin(container) + to * nbrPerParticle);
+        });
+        return iterator(this, from);
+    }
+
+    void swap(ContiguousParticles_& that)
+    {
+        std::swap(iCell, that.iCell);
+        std::swap(delta, that.delta);
+        std::swap(weight, that.weight);
+        std::swap(charge, that.charge);
+        std::swap(v, that.v);
+    }
+
+    bool operator==(ContiguousParticles_ const& that) const
+    {
+        return iCell == that.iCell and delta == that.delta and weight == that.weight
+               and charge == that.charge and v == that.v;
+    }
 
-    auto end() { return iterator(this); }
-    auto cend() const { return iterator(this); }
 
     container_t<int> iCell;
     container_t<double> delta;
     container_t<double> weight, charge, v;
+
+private:
+    template<typename T>
+    static T* data_(std::vector<T>& container)
+    {
+        return container.data();
+    }
+
+    template<typename Container>
+    static auto data_(Container const& container)
+    {
+        return container.data();
+    }
+
+    // a non owning view is made of buffers owned, and writable, by its caller (e.g. numpy
+    // arrays), Span only keeps them as pointers to const
+    template<typename T>
+    static T* data_(Span<T>& span)
+    {
+        return const_cast<T*>(span.data());
+    }
+
+    template<typename Fn>
+    void for_each_container_(Fn&& fn)
+    {
+        fn(iCell, dim);
+        fn(delta, dim);
+        fn(weight, 1);
+        fn(charge, 1);
+        fn(v, 3);
+    }
+
+    template<typename Container>
+    static void insert_(Container& container, Container const& inserted, std::size_t at)
+    {
+        container.insert(std::begin(container) + at, std::begin(inserted), std::end(inserted));
+    }
 };
 
 
@@ -182,7 +479,8 @@ using ContiguousParticlesView = ContiguousParticles<dim, /*OwnedState=*/false>;
 
 template<std::size_t dim, typename T>
 inline constexpr auto is_phare_particle_type
-    = std::is_same_v<Particle<dim>, T> or std::is_same_v<ParticleView<dim>, T>;
+    = std::is_same_v<Particle<dim>, T> or std::is_same_v<ParticleView<dim>, T>
+      or std::is_same_v<ConstParticleView<dim>, T>;
 
 
 template<std::size_t dim, template<std::size_t> typename ParticleA,
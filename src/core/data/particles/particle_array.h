@@ -32,6 +32,7 @@ public:
     }
 
     std::size_t size() const { return particles.size(); }
+    std::size_t capacity() const { return particles.capacity(); }
 
     void clear() { return particles.clear(); }
     void reserve(std::size_t newSize) { return particles.reserve(newSize); }
@@ -94,6 +95,18 @@ namespace core
         array1.swap(array2);
     }
 
+    template<std::size_t dim>
+    void empty(ContiguousParticles<dim>& array)
+    {
+        array.clear();
+    }
+
+    template<std::size_t dim>
+    void swap(ContiguousParticles<dim>& array1, ContiguousParticles<dim>& array2)
+    {
+        array1.swap(array2);
+    }
+
 } // namespace core
 } // namespace PHARE
 
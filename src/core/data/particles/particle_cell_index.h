@@ -0,0 +1,144 @@
+#ifndef PHARE_CORE_DATA_PARTICLES_PARTICLE_CELL_INDEX_H
+#define PHARE_CORE_DATA_PARTICLES_PARTICLE_CELL_INDEX_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "core/utilities/box/box.h"
+#include "core/utilities/box/cell_indexer.h"
+
+
+namespace PHARE::core
+{
+/** ParticleCellIndex bins the indexes of the particles of an array by cell, without moving the
+ * particles, so that the particles of a few cells are found without a scan of the array.
+ *
+ * Cells of the given box are numbered by a CellIndexer, in the same order as in ParticleSorter.
+ * Particles outside the box are binned after the last cell. The index is valid until the
+ * array is modified, except for particles appended to it, which are not indexed: those from
+ * size() on are to be visited by the caller.
+ */
+template<std::size_t dim>
+class ParticleCellIndex
+{
+public:
+    static constexpr auto dimension = dim;
+    using Box_t                     = Box<int, dim>;
+
+
+    template<typename ParticleArray>
+    void build(ParticleArray const& particles, Box_t const& box)
+    {
+        cells_.reset(box);
+
+        nbrParticles_ = particles.size();
+        cellIndexes_.resize(nbrParticles_);
+        offsets_.assign(cells_.size() + 2, 0);
+
+        for (std::size_t iPart = 0; iPart < nbrParticles_; ++iPart)
+        {
+            auto const index    = cells_(particles[iPart].iCell);
+            cellIndexes_[iPart] = index;
+            ++offsets_[index + 1];
+        }
+
+        std::partial_sum(std::begin(offsets_), std::end(offsets_), std::begin(offsets_));
+
+        // offsets_[index] is moved along as particles are binned, and restored afterwards
+        particleIndexes_.resize(nbrParticles_);
+        for (std::size_t iPart = 0; iPart < nbrParticles_; ++iPart)
+            particleIndexes_[offsets_[cellIndexes_[iPart]]++] = iPart;
+
+        for (std::size_t index = offsets_.size() - 1; index > 0; --index)
+            offsets_[index] = offsets_[index - 1];
+        offsets_[0] = 0;
+    }
+
+
+    /** @return the number of indexed particles, those of the array when it was built */
+    std::size_t size() const { return nbrParticles_; }
+
+
+    /** calls fn(iPart) for the index of each indexed particle that may lie in box: those of its
+     * cells in the indexed box, and those outside the indexed box if box extends beyond it.
+     */
+    template<typename Fn>
+    void visit(Box_t const& box, Fn&& fn) const
+    {
+        auto const& indexed = cells_.box();
+
+        Box_t cells;
+        bool overlaps = true, inside = true;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            cells.lower[iDim] = std::max(box.lower[iDim], indexed.lower[iDim]);
+            cells.upper[iDim] = std::min(box.upper[iDim], indexed.upper[iDim]);
+            overlaps &= cells.lower[iDim] <= cells.upper[iDim];
+            inside &= box.lower[iDim] >= indexed.lower[iDim]
+                      and box.upper[iDim] <= indexed.upper[iDim];
+        }
+
+        if (overlaps)
+            visitCells_(cells, fn);
+
+        if (!inside)
+            visitBins_(cells_.size(), cells_.size(), fn);
+    }
+
+
+
+private:
+    // the cells of a row along the last direction are consecutive bins
+    template<typename Fn>
+    void visitCells_(Box_t const& cells, Fn& fn) const
+    {
+        auto extent = [&](std::size_t iDim) {
+            return static_cast<std::size_t>(cells.upper[iDim] - cells.lower[iDim] + 1);
+        };
+
+        std::size_t nbrRows = 1;
+        for (std::size_t iDim = 0; iDim + 1 < dim; ++iDim)
+            nbrRows *= extent(iDim);
+
+        std::array<int, dim> first, last;
+        first[dim - 1] = cells.lower[dim - 1];
+        last[dim - 1]  = cells.upper[dim - 1];
+
+        for (std::size_t row = 0; row < nbrRows; ++row)
+        {
+            auto rest = row;
+            for (std::size_t iDim = dim - 1; iDim-- > 0;)
+            {
+                first[iDim] = cells.lower[iDim] + static_cast<int>(rest % extent(iDim));
+                last[iDim]  = first[iDim];
+                rest /= extent(iDim);
+            }
+            visitBins_(cells_(first), cells_(last), fn);
+        }
+    }
+
+
+    template<typename Fn>
+    void visitBins_(std::size_t firstBin, std::size_t lastBin, Fn& fn) const
+    {
+        for (auto i = offsets_[firstBin]; i < offsets_[lastBin + 1]; ++i)
+            fn(particleIndexes_[i]);
+    }
+
+
+
+    CellIndexer<dim> cells_;
+    std::size_t nbrParticles_ = 0;
+
+    std::vector<std::size_t> cellIndexes_;
+    std::vector<std::size_t> offsets_;
+    std::vector<std::size_t> particleIndexes_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -10,16 +10,17 @@
 
 namespace PHARE::core
 {
-template<std::size_t dim>
+template<std::size_t dim, typename ParticleArray_t = ParticleArray<dim>>
 class ParticlePacker
 {
 public:
-    ParticlePacker(ParticleArray<dim> const& particles)
+    ParticlePacker(ParticleArray_t const& particles)
         : particles_{particles}
     {
     }
 
-    static auto get(Particle<dim> const& particle)
+    template<typename Particle_t>
+    static auto get(Particle_t const& particle)
     {
         return std::forward_as_tuple(particle.weight, particle.charge, particle.iCell,
                                      particle.delta, particle.v);
@@ -39,6 +40,20 @@ public:
 
     void pack(ContiguousParticles<dim>& copy)
     {
+        if constexpr (ParticleArray_t::is_contiguous)
+        { // already structure of arrays, no need to go particle per particle
+            auto copyAll = [](auto const& from, auto& to) {
+                std::copy(std::begin(from), std::end(from), std::begin(to));
+            };
+            copyAll(particles_.weight, copy.weight);
+            copyAll(particles_.charge, copy.charge);
+            copyAll(particles_.iCell, copy.iCell);
+            copyAll(particles_.delta, copy.delta);
+            copyAll(particles_.v, copy.v);
+            it_ = particles_.size();
+            return;
+        }
+
         auto copyTo = [](auto& a, auto& idx, auto size, auto& v) {
             std::copy(a.begin(), a.begin() + size, v.begin() + (idx * size));
         };
@@ -56,11 +71,17 @@ public:
     }
 
 private:
-    ParticleArray<dim> const& particles_;
+    ParticleArray_t const& particles_;
     std::size_t it_ = 0;
     static inline std::array<std::string, 5> keys_{"weight", "charge", "iCell", "delta", "v"};
 };
 
+template<std::size_t dim>
+ParticlePacker(ParticleArray<dim> const&) -> ParticlePacker<dim, ParticleArray<dim>>;
+
+template<std::size_t dim>
+ParticlePacker(ContiguousParticles<dim> const&) -> ParticlePacker<dim, ContiguousParticles<dim>>;
+
 
 } // namespace PHARE::core
 
@@ -0,0 +1,110 @@
+#ifndef PHARE_CORE_DATA_PARTICLES_PARTICLE_SORTER_H
+#define PHARE_CORE_DATA_PARTICLES_PARTICLE_SORTER_H
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+#include "core/utilities/box/box.h"
+#include "core/utilities/box/cell_indexer.h"
+#include "core/utilities/point/point.h"
+#include "core/utilities/range/range.h"
+
+
+namespace PHARE::core
+{
+/** ParticleSorter orders the particles of an array by cell with a stable counting sort.
+ *
+ * Cells of the given box are numbered in the same (row major) order as field nodes in
+ * NdArrayVector, so that consecutive particles gather from and deposit onto nearby memory.
+ * Particles outside the box are kept, in their original order, after the last cell.
+ *
+ * The sorter keeps the per cell offsets of the last sorted array, which cellRange() uses
+ * to give the particles of a cell. They are valid until that array is modified.
+ * Buffers are reused from one call to the other, so one sorter is meant to be used for
+ * all the arrays of a patch level.
+ */
+template<typename ParticleArray>
+class ParticleSorter
+{
+public:
+    static constexpr auto dimension = ParticleArray::dimension;
+    using Box_t                     = Box<int, dimension>;
+    using iterator                  = typename ParticleArray::iterator;
+
+
+    /** sorts particles by cell of the given box.
+     * particles already sorted are left untouched, only the cell offsets are computed.
+     */
+    void operator()(ParticleArray& particles, Box_t const& box)
+    {
+        cells_.reset(box);
+
+        auto const nbrParticles = particles.size();
+        cellIndexes_.resize(nbrParticles);
+        offsets_.assign(cells_.size() + 2, 0);
+
+        bool sorted = true;
+        for (std::size_t iPart = 0; iPart < nbrParticles; ++iPart)
+        {
+            auto const index    = cells_(particles[iPart].iCell);
+            cellIndexes_[iPart] = index;
+            sorted &= iPart == 0 or cellIndexes_[iPart - 1] <= index;
+            ++offsets_[index + 1];
+        }
+
+        std::partial_sum(std::begin(offsets_), std::end(offsets_), std::begin(offsets_));
+
+        if (sorted)
+            return;
+
+        // offsets_[index] is moved along as particles are placed, and restored afterwards
+        sorted_.resize(nbrParticles);
+        for (std::size_t iPart = 0; iPart < nbrParticles; ++iPart)
+            sorted_[offsets_[cellIndexes_[iPart]]++] = particles[iPart];
+
+        for (std::size_t index = offsets_.size() - 1; index > 0; --index)
+            offsets_[index] = offsets_[index - 1];
+        offsets_[0] = 0;
+
+        particles.swap(sorted_);
+    }
+
+
+    /** @return the range of the particles of the given AMR cell in the last sorted array */
+    auto cellRange(ParticleArray& particles, Point<int, dimension> const& cell) const
+    {
+        auto const index = cells_(cell);
+        return makeRange(std::begin(particles) + offsets_[index],
+                         std::begin(particles) + offsets_[index + 1]);
+    }
+
+
+    /** @return the range of the particles outside the box in the last sorted array */
+    auto outsideRange(ParticleArray& particles) const
+    {
+        return makeRange(std::begin(particles) + offsets_[cells_.size()],
+                         std::begin(particles) + offsets_[cells_.size() + 1]);
+    }
+
+
+    /** @return nbrCells + 2 offsets, the particles of cell i being in [offsets[i], offsets[i+1])
+     * and those outside the box in [offsets[nbrCells], offsets[nbrCells + 1])
+     */
+    auto& offsets() const { return offsets_; }
+
+
+
+private:
+    CellIndexer<dimension> cells_;
+
+    std::vector<std::size_t> cellIndexes_;
+    std::vector<std::size_t> offsets_;
+    ParticleArray sorted_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
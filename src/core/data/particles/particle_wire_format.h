@@ -0,0 +1,267 @@
+#ifndef PHARE_CORE_DATA_PARTICLES_PARTICLE_WIRE_FORMAT_H
+#define PHARE_CORE_DATA_PARTICLES_PARTICLE_WIRE_FORMAT_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/data/particles/particle.h"
+#include "core/utilities/box/box.h"
+
+
+#if !defined(PHARE_PARTICLE_STREAM_DELTA)
+#define PHARE_PARTICLE_STREAM_DELTA 0 // see DeltaEncoding
+#endif
+
+
+namespace PHARE::core
+{
+/** how particle deltas are sent: as doubles, as floats, or as 16 bit fractions of the cell */
+enum class DeltaEncoding : std::uint8_t { Double = 0, Float32 = 1, Fixed16 = 2 };
+
+
+
+/** ParticleWireFormat encodes particles for MPI streams, one column per attribute, in the
+ * following order, after a header made of a format word and of the number of particles:
+ *
+ *   weight, charge : double
+ *   iCell          : 16 bit index relative to the lower cell of the box given at construction,
+ *                    32 bit if the box is larger than 65536 cells in a direction
+ *   delta          : double, float or 16 bit fraction, see DeltaEncoding
+ *   v              : double
+ *
+ * The box is the one of the cells of the streamed particles, known to both ends of the stream.
+ * The format word holds the version, the delta encoding and the width of iCell, so that the
+ * reader decodes whatever the encoding of the writer.
+ *
+ * Encoded deltas remain in [0, 1[, with an error below 2^-24 for Float32 and 2^-17 for Fixed16.
+ *
+ * A Stream has pack(T const*, std::size_t) and unpack(T*, std::size_t) members, which is the
+ * case of SAMRAI::tbox::MessageStream.
+ */
+template<std::size_t dim>
+class ParticleWireFormat
+{
+public:
+    using Particle_t = Particle<dim>;
+    using Box_t      = Box<int, dim>;
+
+    static constexpr std::uint8_t version = 1;
+    static constexpr auto defaultDeltaEncoding
+        = static_cast<DeltaEncoding>(PHARE_PARTICLE_STREAM_DELTA);
+
+
+    explicit ParticleWireFormat(Box_t const& box,
+                                DeltaEncoding deltaEncoding = defaultDeltaEncoding)
+        : lower_{box.lower}
+        , deltaEncoding_{deltaEncoding}
+    {
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            wideCells_ |= box.upper[iDim] - box.lower[iDim] > narrowCellMax;
+    }
+
+
+    static constexpr std::size_t headerSize()
+    {
+        return sizeof(std::uint32_t) + sizeof(std::uint64_t);
+    }
+
+
+    /** @return the exact number of bytes written for nbrParticles particles */
+    std::size_t size(std::size_t nbrParticles) const
+    {
+        return headerSize() + nbrParticles * particleSize_(deltaEncoding_, wideCells_);
+    }
+
+
+    template<typename Stream, typename Particles>
+    void write(Stream& stream, Particles const& particles) const
+    {
+        std::uint32_t const format = version | static_cast<std::uint32_t>(deltaEncoding_) << 8
+                                     | static_cast<std::uint32_t>(wideCells_) << 16;
+        std::uint64_t const nbrParticles = particles.size();
+
+        stream.pack(&format, 1);
+        stream.pack(&nbrParticles, 1);
+
+        packColumn_<double>(stream, particles, [](auto const& part) { return part.weight; });
+        packColumn_<double>(stream, particles, [](auto const& part) { return part.charge; });
+
+        if (wideCells_)
+            packCells_<std::int32_t>(stream, particles);
+        else
+            packCells_<std::uint16_t>(stream, particles);
+
+        if (deltaEncoding_ == DeltaEncoding::Double)
+            packDeltas_<double>(stream, particles, [](double delta) { return delta; });
+
+        else if (deltaEncoding_ == DeltaEncoding::Float32)
+            packDeltas_<float>(stream, particles, [](double delta) {
+                return std::min(static_cast<float>(delta), maxFloatDelta);
+            });
+
+        else
+            packDeltas_<std::uint16_t>(stream, particles, [](double delta) {
+                return static_cast<std::uint16_t>(
+                    std::min(delta * fixedDeltaScale, fixedDeltaMax));
+            });
+
+        for (std::size_t iComp = 0; iComp < 3; ++iComp)
+            packColumn_<double>(stream, particles,
+                                [iComp](auto const& particle) { return particle.v[iComp]; });
+    }
+
+
+    template<typename Stream>
+    std::vector<Particle_t> read(Stream& stream) const
+    {
+        std::uint32_t format       = 0;
+        std::uint64_t nbrParticles = 0;
+        stream.unpack(&format, 1);
+        stream.unpack(&nbrParticles, 1);
+
+        if ((format & 0xff) != version)
+            throw std::runtime_error("ParticleWireFormat: cannot read version "
+                                     + std::to_string(format & 0xff));
+
+        auto const deltaEncoding = static_cast<DeltaEncoding>((format >> 8) & 0xff);
+        bool const wideCells     = (format >> 16) & 0xff;
+
+        std::vector<Particle_t> particles(nbrParticles);
+
+        unpackColumn_<double>(stream, particles,
+                              [](auto& particle, double weight) { particle.weight = weight; });
+        unpackColumn_<double>(stream, particles,
+                              [](auto& particle, double charge) { particle.charge = charge; });
+
+        if (wideCells)
+            unpackCells_<std::int32_t>(stream, particles);
+        else
+            unpackCells_<std::uint16_t>(stream, particles);
+
+        if (deltaEncoding == DeltaEncoding::Double)
+            unpackDeltas_<double>(stream, particles, [](double delta) { return delta; });
+
+        else if (deltaEncoding == DeltaEncoding::Float32)
+            unpackDeltas_<float>(stream, particles,
+                                 [](float delta) { return static_cast<double>(delta); });
+
+        else if (deltaEncoding == DeltaEncoding::Fixed16)
+            unpackDeltas_<std::uint16_t>(stream, particles, [](std::uint16_t delta) {
+                return (delta + .5) / fixedDeltaScale;
+            });
+
+        else
+            throw std::runtime_error("ParticleWireFormat: unknown delta encoding");
+
+        for (std::size_t iComp = 0; iComp < 3; ++iComp)
+            unpackColumn_<double>(stream, particles, [iComp](auto& particle, double v) {
+                particle.v[iComp] = v;
+            });
+
+        return particles;
+    }
+
+
+
+private:
+    static constexpr int narrowCellMax      = std::numeric_limits<std::uint16_t>::max();
+    static constexpr double fixedDeltaScale = 65536.;
+    static constexpr double fixedDeltaMax   = fixedDeltaScale - 1;
+    static constexpr float maxFloatDelta    = 1.f - std::numeric_limits<float>::epsilon() / 2;
+
+
+    static constexpr std::size_t particleSize_(DeltaEncoding deltaEncoding, bool wideCells)
+    {
+        std::size_t const cellSize  = wideCells ? sizeof(std::int32_t) : sizeof(std::uint16_t);
+        std::size_t const deltaSize
+            = deltaEncoding == DeltaEncoding::Double    ? sizeof(double)
+              : deltaEncoding == DeltaEncoding::Float32 ? sizeof(float)
+                                                        : sizeof(std::uint16_t);
+        return 2 * sizeof(double) + dim * (cellSize + deltaSize) + 3 * sizeof(double);
+    }
+
+
+    template<typename T, typename Stream, typename Particles, typename Get>
+    void packColumn_(Stream& stream, Particles const& particles, Get&& get) const
+    {
+        std::vector<T> column;
+        column.reserve(particles.size());
+        for (auto const& particle : particles)
+            column.push_back(get(particle));
+        stream.pack(column.data(), column.size());
+    }
+
+
+    template<typename T, typename Stream, typename Particles>
+    void packCells_(Stream& stream, Particles const& particles) const
+    {
+        std::vector<T> column;
+        column.reserve(dim * particles.size());
+        for (auto const& particle : particles)
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                column.push_back(static_cast<T>(particle.iCell[iDim] - lower_[iDim]));
+        stream.pack(column.data(), column.size());
+    }
+
+
+    template<typename T, typename Stream, typename Particles, typename Encode>
+    void packDeltas_(Stream& stream, Particles const& particles, Encode&& encode) const
+    {
+        std::vector<T> column;
+        column.reserve(dim * particles.size());
+        for (auto const& particle : particles)
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                column.push_back(encode(particle.delta[iDim]));
+        stream.pack(column.data(), column.size());
+    }
+
+
+    template<typename T, typename Stream, typename Set>
+    void unpackColumn_(Stream& stream, std::vector<Particle_t>& particles, Set&& set) const
+    {
+        std::vector<T> column(particles.size());
+        stream.unpack(column.data(), column.size());
+        for (std::size_t iPart = 0; iPart < particles.size(); ++iPart)
+            set(particles[iPart], column[iPart]);
+    }
+
+
+    template<typename T, typename Stream>
+    void unpackCells_(Stream& stream, std::vector<Particle_t>& particles) const
+    {
+        std::vector<T> column(dim * particles.size());
+        stream.unpack(column.data(), column.size());
+        for (std::size_t iPart = 0; iPart < particles.size(); ++iPart)
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                particles[iPart].iCell[iDim]
+                    = lower_[iDim] + static_cast<int>(column[iPart * dim + iDim]);
+    }
+
+
+    template<typename T, typename Stream, typename Decode>
+    void unpackDeltas_(Stream& stream, std::vector<Particle_t>& particles, Decode&& decode) const
+    {
+        std::vector<T> column(dim * particles.size());
+        stream.unpack(column.data(), column.size());
+        for (std::size_t iPart = 0; iPart < particles.size(); ++iPart)
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                particles[iPart].delta[iDim] = decode(column[iPart * dim + iDim]);
+    }
+
+
+
+    Point<int, dim> lower_;
+    DeltaEncoding deltaEncoding_;
+    bool wideCells_ = false;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -5,10 +5,13 @@
 
 #include <array>
 #include <cstddef>
+#include <iterator>
+#include <algorithm>
 
 #include "core/data/grid/gridlayout.h"
 #include "core/data/vecfield/vecfield_component.h"
 #include "core/utilities/point/point.h"
+#include "core/utilities/types.h"
 
 #include "core/logger.h"
 
@@ -68,6 +71,19 @@ namespace core
             weights[0] = 1. - weights[1];
         }
 
+        //! same as computeWeight for a batch of N particles, weights are [point][particle]
+        template<std::size_t N>
+        static inline void computeWeights(std::array<double, N> const& normalizedPos,
+                                          std::array<int, N> const& startIndex,
+                                          std::array<std::array<double, N>, 2>& weights)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                weights[1][i] = normalizedPos[i] - static_cast<double>(startIndex[i]);
+                weights[0][i] = 1. - weights[1][i];
+            }
+        }
+
         static const int interp_order = 1;
     };
 
@@ -93,6 +109,24 @@ namespace core
             weights[2] = 0.5 * coef3 * coef3;
         }
 
+        //! same as computeWeight for a batch of N particles, weights are [point][particle]
+        template<std::size_t N>
+        static inline void computeWeights(std::array<double, N> const& normalizedPos,
+                                          std::array<int, N> const& startIndex,
+                                          std::array<std::array<double, N>, 3>& weights)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                double const delta = static_cast<double>(startIndex[i] + 1) - normalizedPos[i];
+                double const coef1 = 0.5 + delta;
+                double const coef3 = 0.5 - delta;
+
+                weights[0][i] = 0.5 * coef1 * coef1;
+                weights[1][i] = 0.75 - delta * delta;
+                weights[2][i] = 0.5 * coef3 * coef3;
+            }
+        }
+
         static const int interp_order = 2;
     };
 
@@ -125,6 +159,32 @@ namespace core
             weights[3] = (4. / 3.) * coef4 * coef4 * coef4;
         }
 
+        //! same as computeWeight for a batch of N particles, weights are [point][particle]
+        template<std::size_t N>
+        static inline void computeWeights(std::array<double, N> const& normalizedPos,
+                                          std::array<int, N> const& startIndex,
+                                          std::array<std::array<double, N>, 4>& weights)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                double const index = static_cast<double>(startIndex[i]) - normalizedPos[i];
+                double const coef1 = 1. + 0.5 * index;
+                double const coef2 = index + 1;
+                double const coef3 = index + 2;
+                double const coef4 = 1. - 0.5 * (index + 3);
+
+                double const coef2_sq  = coef2 * coef2;
+                double const coef2_cub = coef2_sq * coef2;
+                double const coef3_sq  = coef3 * coef3;
+                double const coef3_cub = coef3_sq * coef3;
+
+                weights[0][i] = (4. / 3.) * coef1 * coef1 * coef1;
+                weights[1][i] = 2. / 3. - coef2_sq - 0.5 * coef2_cub;
+                weights[2][i] = 2. / 3. - coef3_sq + 0.5 * coef3_cub;
+                weights[3][i] = (4. / 3.) * coef4 * coef4 * coef4;
+            }
+        }
+
         static const int interp_order = 3;
     };
 
@@ -513,54 +573,74 @@ namespace core
     public:
         auto static constexpr interp_order = interpOrder;
         auto static constexpr dimension    = dim;
-        /**\brief interpolate electromagnetic fields on all particles in the range
+
+        //! number of particles for which indexes and weights are computed at once
+        static constexpr std::size_t batch_size = PHARE_SIMD_BATCH_SIZE;
+
+        template<typename T>
+        using lanes_t = std::array<T, batch_size>;
+
+        /**\brief interpolate electromagnetic fields on a particle
+         *
+         * The function first calculates the startIndex and weights for interpolation at
+         * order InterpOrder and in dimension dim for dual and primal nodes, then it uses
+         * MeshToParticle to calculate the interpolation of E and B components onto the particle.
          *
-         * For each particle :
-         *  - The function first calculates the startIndex and weights for interpolation at
-         * order InterpOrder and in dimension dim for dual and primal nodes
-         *  - then it uses Interpol<> to calculate the interpolation of E and B components
-         * onto the particle.
+         * Fields are returned as {{Ex, Ey, Ez}, {Bx, By, Bz}} rather than stored on the particle
+         * so that the caller can consume them right away (e.g. the pusher acceleration).
          */
-        template<typename PartIterator, typename Electromag, typename GridLayout>
-        inline void operator()(PartIterator begin, PartIterator end, Electromag const& Em,
+        template<typename Particle_t, typename Electromag, typename GridLayout>
+        inline auto operator()(Particle_t const& particle, Electromag const& Em,
                                GridLayout const& layout)
         {
-            PHARE_LOG_SCOPE("Interpolator::operator()");
-
-            // this lambda calculates the startIndex and the nbrPointsSupport() weights for
-            // dual field interpolation and puts this at the corresponding location
-            // in 'startIndex' and 'weights'. For dual fields, the normalizedPosition
-            // is offseted compared to primal ones.
-            auto indexAndWeightDual = [this, &layout](auto const& part) {
-                for (auto iDim = 0u; iDim < dimension; ++iDim)
-                {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim] + dualOffset(interpOrder);
+            PHARE_LOG_SCOPE("MeshToParticle::operator()");
 
-                    startIndex_[centering2int(QtyCentering::dual)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
+            using Scalar = HybridQuantity::Scalar;
 
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::dual)][iDim],
-                        weights_[centering2int(QtyCentering::dual)][iDim]);
-                }
+            auto const& Ex = Em.E.getComponent(Component::X);
+            auto const& Ey = Em.E.getComponent(Component::Y);
+            auto const& Ez = Em.E.getComponent(Component::Z);
+            auto const& Bx = Em.B.getComponent(Component::X);
+            auto const& By = Em.B.getComponent(Component::Y);
+            auto const& Bz = Em.B.getComponent(Component::Z);
+
+            // the startIndex and weights are only calculated twice (primal and dual)
+            // and not for each E,B component.
+            indexAndWeights_<QtyCentering::primal>(layout, particle);
+            indexAndWeights_<QtyCentering::dual>(layout, particle);
+
+            auto interpolate = [&](auto const& field, auto quantity) {
+                return meshToParticle_(field, GridLayout::centering(quantity), startIndex_,
+                                       weights_);
             };
 
-            // does the same as above but for a primal field
-            auto indexAndWeightPrimal = [this, &layout](auto const& part) {
-                for (auto iDim = 0u; iDim < dimension; ++iDim)
-                {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim];
+            return std::array<std::array<double, 3>, 2>{{
+                {interpolate(Ex, Scalar::Ex), interpolate(Ey, Scalar::Ey),
+                 interpolate(Ez, Scalar::Ez)},
+                {interpolate(Bx, Scalar::Bx), interpolate(By, Scalar::By),
+                 interpolate(Bz, Scalar::Bz)},
+            }};
+        }
+
 
-                    startIndex_[centering2int(QtyCentering::primal)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
 
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::primal)][iDim],
-                        weights_[centering2int(QtyCentering::primal)][iDim]);
-                }
-            };
+
+        /**\brief interpolate electromagnetic fields on a batch of at most batch_size particles
+         *
+         * Start indexes and weights of the batch are computed at once, in a vectorized way,
+         * and shared by the six E and B components.
+         * Fields of the ith particle are written in E[component][i] and B[component][i].
+         */
+        template<typename PartIterator, typename Electromag, typename GridLayout,
+                 std::size_t N>
+        inline void gather(PartIterator first, std::size_t size, Electromag const& Em,
+                           GridLayout const& layout, std::array<std::array<double, N>, 3>& E,
+                           std::array<std::array<double, N>, 3>& B)
+        {
+            static_assert(N <= batch_size, "batch larger than the interpolator batch_size");
+            PHARE_LOG_SCOPE("MeshToParticle::gather");
+
+            using Scalar = HybridQuantity::Scalar;
 
             auto const& Ex = Em.E.getComponent(Component::X);
             auto const& Ey = Em.E.getComponent(Component::Y);
@@ -569,88 +649,38 @@ namespace core
             auto const& By = Em.B.getComponent(Component::Y);
             auto const& Bz = Em.B.getComponent(Component::Z);
 
-            auto const ExCentering = GridLayout::centering(HybridQuantity::Scalar::Ex);
-            auto const EyCentering = GridLayout::centering(HybridQuantity::Scalar::Ey);
-            auto const EzCentering = GridLayout::centering(HybridQuantity::Scalar::Ez);
-            auto const BxCentering = GridLayout::centering(HybridQuantity::Scalar::Bx);
-            auto const ByCentering = GridLayout::centering(HybridQuantity::Scalar::By);
-            auto const BzCentering = GridLayout::centering(HybridQuantity::Scalar::Bz);
-
+            computeTile_(first, size, layout);
 
-            // for each particle, first calculate the startIndex and weights
-            // for dual and primal quantities.
-            // then, knowing the centering (primal or dual) of each electromagnetic
-            // component, we use Interpol to actually perform the interpolation.
-            // the trick here is that the StartIndex and weights have only been calculated
-            // twice, and not for each E,B component.
+            auto interpolate = [&](auto const& field, auto quantity, std::size_t i) {
+                return meshToParticle_(field, GridLayout::centering(quantity),
+                                       tile_.startIndex[i], tile_.weights[i]);
+            };
 
-            PHARE_LOG_START("MeshToParticle::operator()");
-            for (auto currPart = begin; currPart != end; ++currPart)
+            for (std::size_t i = 0; i < size; ++i)
             {
-                indexAndWeightPrimal(*currPart);
-                indexAndWeightDual(*currPart);
-
-                currPart->Ex = meshToParticle_(Ex, ExCentering, startIndex_, weights_);
-                currPart->Ey = meshToParticle_(Ey, EyCentering, startIndex_, weights_);
-                currPart->Ez = meshToParticle_(Ez, EzCentering, startIndex_, weights_);
-                currPart->Bx = meshToParticle_(Bx, BxCentering, startIndex_, weights_);
-                currPart->By = meshToParticle_(By, ByCentering, startIndex_, weights_);
-                currPart->Bz = meshToParticle_(Bz, BzCentering, startIndex_, weights_);
+                E[0][i] = interpolate(Ex, Scalar::Ex, i);
+                E[1][i] = interpolate(Ey, Scalar::Ey, i);
+                E[2][i] = interpolate(Ez, Scalar::Ez, i);
+                B[0][i] = interpolate(Bx, Scalar::Bx, i);
+                B[1][i] = interpolate(By, Scalar::By, i);
+                B[2][i] = interpolate(Bz, Scalar::Bz, i);
             }
-            PHARE_LOG_STOP("MeshToParticle::operator()");
         }
 
 
 
 
-        /**\brief interpolate electromagnetic fields on all particles in the range
+        /**\brief deposit the density and flux of all particles in the range on the mesh
          *
-         * For each particle :
-         *  - The function first calculates the startIndex and weights for interpolation at
-         * order InterpOrder and in dimension dim for dual and primal nodes
-         *  - then it uses Interpol<> to calculate the interpolation of E and B components
-         * onto the particle.
+         * Particles are processed by batches of batch_size, for which start indexes and
+         * weights are computed at once, in a vectorized way, and shared by the density and
+         * the three flux components. ParticleToMesh then projects each particle.
          */
         template<typename PartIterator, typename VecField, typename GridLayout,
                  typename Field = typename VecField::field_type>
         inline void operator()(PartIterator begin, PartIterator end, Field& density, VecField& flux,
                                GridLayout const& layout, double coef = 1.)
         {
-            // this lambda calculates the startIndex and the order+1 weights for
-            // dual field interpolation and puts this at the corresponding location
-            // in 'startIndex' and 'weights'. For dual fields, the normalizedPosition
-            // is offseted compared to primal ones.
-            auto indexAndWeightDual = [this, &layout](auto const& part) {
-                for (auto iDim = 0u; iDim < dimension; ++iDim)
-                {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim] + dualOffset(interpOrder);
-
-                    startIndex_[centering2int(QtyCentering::dual)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
-
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::dual)][iDim],
-                        weights_[centering2int(QtyCentering::dual)][iDim]);
-                }
-            };
-
-            // does the same as above but for a primal field
-            auto indexAndWeightPrimal = [this, &layout](auto const& part) {
-                for (auto iDim = 0u; iDim < dimension; ++iDim)
-                {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim];
-
-                    startIndex_[centering2int(QtyCentering::primal)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
-
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::primal)][iDim],
-                        weights_[centering2int(QtyCentering::primal)][iDim]);
-                }
-            };
-
             auto& xFlux = flux.getComponent(Component::X);
             auto& yFlux = flux.getComponent(Component::Y);
             auto& zFlux = flux.getComponent(Component::Z);
@@ -658,23 +688,22 @@ namespace core
             auto constexpr densityCentering = GridLayout::centering(HybridQuantity::Scalar::rho);
             auto constexpr fluxCentering    = GridLayout::centering(HybridQuantity::Vector::V);
 
-
-            // for each particle, first calculate the startIndex and weights
-            // for dual and primal quantities.
-            // then, knowing the centering (primal or dual) of each electromagnetic
-            // component, we use Interpol to actually perform the interpolation.
-            // the trick here is that the StartIndex and weights have only been calculated
-            // twice, and not for each E,B component.
-
             PHARE_LOG_START("ParticleToMesh::operator()");
-            for (auto currPart = begin; currPart != end; ++currPart)
+            auto const nbrParticles = static_cast<std::size_t>(std::distance(begin, end));
+            for (std::size_t start = 0; start < nbrParticles; start += batch_size)
             {
+                auto const size  = std::min(batch_size, nbrParticles - start);
+                auto const first = begin + static_cast<std::ptrdiff_t>(start);
+
                 // TODO #3375
-                indexAndWeightPrimal(*currPart);
-                indexAndWeightDual(*currPart);
+                computeTile_(first, size, layout);
 
-                particleToMesh_(density, xFlux, yFlux, zFlux, densityCentering, fluxCentering,
-                                *currPart, startIndex_, weights_, coef);
+                auto currPart = first;
+                for (std::size_t i = 0; i < size; ++i, ++currPart)
+                {
+                    particleToMesh_(density, xFlux, yFlux, zFlux, densityCentering, fluxCentering,
+                                    *currPart, tile_.startIndex[i], tile_.weights[i], coef);
+                }
             }
             PHARE_LOG_STOP("ParticleToMesh::operator()");
         }
@@ -691,9 +720,22 @@ namespace core
         ParticleToMesh<dimension> particleToMesh_;
 
         // array[dual/primal][dim]
-        std::array<std::array<int, dimension>, 2> startIndex_;
-        std::array<std::array<std::array<double, nbrPointsSupport(interpOrder)>, dimension>, 2>
-            weights_;
+        using StartIndex_t = std::array<std::array<int, dimension>, 2>;
+        using Weights_t
+            = std::array<std::array<std::array<double, nbrPointsSupport(interpOrder)>, dimension>,
+                         2>;
+
+        StartIndex_t startIndex_;
+        Weights_t weights_;
+
+        //! start indexes and weights of each particle of a batch
+        struct WeightsTile
+        {
+            lanes_t<StartIndex_t> startIndex;
+            lanes_t<Weights_t> weights;
+        };
+
+        WeightsTile tile_;
 
         /**
          * @brief dualOffset returns the offset by which changing the
@@ -704,6 +746,80 @@ namespace core
             std::array<double, 3> offsets = {{-0.5, -0.5, 0.5}};
             return offsets[static_cast<std::array<double, 3>::size_type>(order - 1)];
         }
+
+
+        /** calculates the startIndex and the nbrPointsSupport() weights for the given centering
+         * and puts this at the corresponding location in 'startIndex_' and 'weights_'.
+         * For dual fields, the normalizedPosition is offseted compared to primal ones.
+         */
+        template<QtyCentering centering, typename GridLayout, typename Particle_t>
+        inline void indexAndWeights_(GridLayout const& layout, Particle_t const& part)
+        {
+            auto constexpr iCentering = centering2int(centering);
+            auto const iCell          = layout.AMRToLocal(Point{part.iCell});
+
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                double normalizedPos = iCell[iDim] + part.delta[iDim];
+                if constexpr (centering == QtyCentering::dual)
+                    normalizedPos += dualOffset(interpOrder);
+
+                startIndex_[iCentering][iDim] = computeStartIndex<interpOrder>(normalizedPos);
+                weightComputer_.computeWeight(normalizedPos, startIndex_[iCentering][iDim],
+                                              weights_[iCentering][iDim]);
+            }
+        }
+
+
+        /** fills tile_ for the size particles starting at first.
+         * Positions are first transposed into per direction arrays on which start indexes
+         * and weights are computed for all the batch, lanes past size are left unused.
+         */
+        template<typename PartIterator, typename GridLayout>
+        inline void computeTile_(PartIterator first, std::size_t size, GridLayout const& layout)
+        {
+            auto constexpr nbrPoints = static_cast<std::size_t>(nbrPointsSupport(interpOrder));
+            auto constexpr primal    = centering2int(QtyCentering::primal);
+            auto constexpr dual      = centering2int(QtyCentering::dual);
+
+            // AMR to local cell index offset, the same for all particles
+            auto const localOrigin = layout.AMRToLocal(Point{ConstArray<int, dimension>(0)});
+
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                lanes_t<double> primalPos{}, dualPos{};
+                lanes_t<int> primalStart{}, dualStart{};
+                std::array<lanes_t<double>, nbrPoints> primalWeights, dualWeights;
+
+                auto particle = first;
+                for (std::size_t i = 0; i < size; ++i, ++particle)
+                {
+                    auto const& part = *particle;
+                    primalPos[i]     = (part.iCell[iDim] + localOrigin[iDim]) + part.delta[iDim];
+                }
+
+                for (std::size_t i = 0; i < batch_size; ++i)
+                {
+                    dualPos[i]     = primalPos[i] + dualOffset(interpOrder);
+                    primalStart[i] = computeStartIndex<interpOrder>(primalPos[i]);
+                    dualStart[i]   = computeStartIndex<interpOrder>(dualPos[i]);
+                }
+
+                Weighter<interpOrder>::computeWeights(primalPos, primalStart, primalWeights);
+                Weighter<interpOrder>::computeWeights(dualPos, dualStart, dualWeights);
+
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    tile_.startIndex[i][primal][iDim] = primalStart[i];
+                    tile_.startIndex[i][dual][iDim]   = dualStart[i];
+                    for (std::size_t ik = 0; ik < nbrPoints; ++ik)
+                    {
+                        tile_.weights[i][primal][iDim][ik] = primalWeights[ik][i];
+                        tile_.weights[i][dual][iDim][ik]   = dualWeights[ik][i];
+                    }
+                }
+            }
+        }
     };
 
 
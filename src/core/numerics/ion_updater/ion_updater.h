@@ -3,6 +3,8 @@
 
 
 #include "core/utilities/box/box.h"
+#include "core/utilities/thread_pool.h"
+#include "core/data/particles/particle_sorter.h"
 #include "core/numerics/interpolator/interpolator.h"
 #include "core/numerics/pusher/pusher.h"
 #include "core/numerics/pusher/pusher_factory.h"
@@ -15,7 +17,11 @@
 
 #include "core/logger.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <memory>
+#include <vector>
 
 // TODO alpha coef for interpolating new and old levelGhost should be given somehow...
 
@@ -34,24 +40,113 @@ public:
     using Box               = PHARE::core::Box<int, dimension>;
     using Interpolator      = PHARE::core::Interpolator<dimension, interp_order>;
     using VecField          = typename Ions::vecfield_type;
+    using Field             = typename Ions::field_type;
     using ParticleArray     = typename Ions::particle_array_type;
     using PartIterator      = typename ParticleArray::iterator;
     using BoundaryCondition = PHARE::core::BoundaryCondition<dimension, interp_order>;
     using Pusher            = PHARE::core::Pusher<dimension, PartIterator, Electromag, Interpolator,
                                        BoundaryCondition, GridLayout>;
 
+
+    /** counts the allocations of the particle arrays the updater writes to, that is its scratch
+     * arrays and the domain arrays entering particles are appended to, and of its moment
+     * buffers. They only happen while these grow, so steady state steps do not allocate.
+     */
+    struct ScratchStats
+    {
+        std::size_t nbrAllocations = 0;
+        std::size_t nbrParticles   = 0; // capacity of the scratch arrays
+    };
+
+
+    /** particles of the populations of a patch set aside from one call of the updater to the
+     * other, indexed by population. They are kept by the caller, one per patch, since these
+     * calls can be made by different updaters, see setAside() and updateBorder().
+     */
+    struct AsideParticles
+    {
+        std::vector<ParticleArray> domain;     // time n domain particles
+        std::vector<ParticleArray> patchGhost; // time n patch ghost particles
+        std::vector<ParticleArray> border;     // scratch of updateBorder() in UpdaterMode::all
+        std::vector<std::size_t> nbrBulk;      // bulk particles, first in domain
+    };
+
 private:
     constexpr static auto makePusher
         = PHARE::core::PusherFactory::makePusher<dimension, PartIterator, Electromag, Interpolator,
                                                  BoundaryCondition, GridLayout>;
 
+    // moments deposited by a chunk of domain particles, see pushAndDepositDomain_
+    struct ChunkMoments
+    {
+        ChunkMoments(GridLayout const& layout)
+            : shape{layout.allocSize(HybridQuantity::Scalar::rho)}
+            , density{"chunkDensity", HybridQuantity::Scalar::rho, shape}
+            , fx{"chunkFlux_x", HybridQuantity::Scalar::Vx,
+                 layout.allocSize(HybridQuantity::Scalar::Vx)}
+            , fy{"chunkFlux_y", HybridQuantity::Scalar::Vy,
+                 layout.allocSize(HybridQuantity::Scalar::Vy)}
+            , fz{"chunkFlux_z", HybridQuantity::Scalar::Vz,
+                 layout.allocSize(HybridQuantity::Scalar::Vz)}
+        {
+            flux.setBuffer("chunkFlux_x", &fx);
+            flux.setBuffer("chunkFlux_y", &fy);
+            flux.setBuffer("chunkFlux_z", &fz);
+        }
+
+        std::array<std::uint32_t, dimension> shape;
+        Field density;
+        Field fx, fy, fz;
+        VecField flux{"chunkFlux", HybridQuantity::Vector::V};
+    };
+
+
     std::unique_ptr<Pusher> pusher_;
     Interpolator interpolator_;
+    ParticleSorter<ParticleArray> sorter_;
+    std::size_t sortInterval_ = 0;
+
+    // domain particles of a patch are pushed and deposited by chunks, one per thread
+    ThreadPool threadPool_;
+    std::vector<std::unique_ptr<Pusher>> chunkPushers_;
+    std::vector<Interpolator> chunkInterpolators_;
+    std::vector<std::unique_ptr<ChunkMoments>> chunkMoments_;
+
+    // particle arrays of a population kept from one call to the other, so that steady state
+    // steps reuse their capacity. UpdaterMode::domain_only pushes domain particles into pushed,
+    // and copies those neighbour patches need into predicted, see predictedParticles()
+    struct PopulationScratch
+    {
+        ParticleArray pushed;
+        ParticleArray patchGhost;
+        ParticleArray levelGhost;
+        ParticleArray predicted;
+    };
+
+    std::vector<PopulationScratch> scratch_;
+    ScratchStats scratchStats_;
+
+    // chunk bounds and ends of the threaded push, see chunks_
+    std::vector<std::size_t> chunkBounds_;
+    std::vector<PartIterator> chunkEnds_;
 
 public:
+    /** domain particles of a patch are pushed and deposited by "nbr_threads" threads
+     * (default 1). Results only depend on the number of threads, not on their scheduling.
+     */
     IonUpdater(PHARE::initializer::PHAREDict const& dict)
         : pusher_{makePusher(dict["pusher"]["name"].template to<std::string>())}
+        , threadPool_{dict.contains("nbr_threads") ? dict["nbr_threads"].template to<std::size_t>()
+                                                   : 1}
+        , chunkInterpolators_(threadPool_.size())
     {
+        if (dict.contains("sort"))
+            sortInterval_ = dict["sort"]["interval"].template to<std::size_t>();
+
+        if (threadPool_.size() > 1)
+            for (std::size_t i = 0; i < threadPool_.size(); ++i)
+                chunkPushers_.emplace_back(
+                    makePusher(dict["pusher"]["name"].template to<std::string>()));
     }
 
     void updatePopulations(Ions& ions, Electromag const& em, GridLayout const& layout, double dt,
@@ -61,10 +156,153 @@ public:
     void updateIons(Ions& ions, GridLayout const& layout);
 
 
+    /** updateBorder() then updateBulk() do what updatePopulations() does, in two phases that
+     * do not use the same particle arrays, so that the particles neighbour patches need can be
+     * exchanged while the bulk of the particles is pushed.
+     *
+     * updateBorder() pushes the ghost particles and the domain particles of the border, those
+     * out of the domain box shrunk by the particle ghost width and a cell. It leaves in the
+     * domain arrays of the populations all the neighbour patches need: the predicted particles
+     * in UpdaterMode::domain_only, see setAside(), and the pushed border particles in
+     * UpdaterMode::all. The time n domain particles are set aside, the bulk ones first.
+     *
+     * updateBulk() pushes and deposits the bulk particles set aside. These must move by less
+     * than a cell, so that they cannot reach the ghost box of a neighbour patch, which the
+     * caller checks beforehand with maxCellCrossing(). In UpdaterMode::all, mergeBulk() then
+     * appends the domain arrays to the pushed bulk particles, which become the domain arrays.
+     */
+    void updateBorder(Ions& ions, Electromag const& em, GridLayout const& layout, double dt,
+                      UpdaterMode mode, AsideParticles& aside);
+
+    void updateBulk(Ions& ions, Electromag const& em, GridLayout const& layout, double dt,
+                    UpdaterMode mode, AsideParticles& aside);
+
+    void mergeBulk(Ions& ions, AsideParticles& aside);
+
+
+    /** @return a bound of the number of cells domain particles cross along any direction in a
+     * push of dt: the largest |v|.dt/dx at time n, plus what the electric field can add to |v|
+     * in the step. The split-phase push is only valid if it is below 1.
+     */
+    double maxCellCrossing(Ions const& ions, Electromag const& em, GridLayout const& layout,
+                           double dt) const;
+
+
+    /** after an update in UpdaterMode::domain_only, sets the time n domain and patch ghost
+     * particles of the populations aside, and puts the predicted particles in their domain
+     * arrays, for the messenger to exchange. Nothing is copied, arrays are swapped.
+     */
+    void setAside(Ions& ions, AsideParticles& aside);
+
+
+    /** @return true if domain particles are to be sorted by cell at the given step,
+     * i.e. every "sort/interval" steps, never if the interval is 0 (default)
+     */
+    bool sortIsDue(std::size_t step) const
+    {
+        return sortInterval_ > 0 and step % sortInterval_ == 0;
+    }
+
+    /** sorts the domain particles of each population by cell of the layout AMR box.
+     * sorter() then gives the cell ranges of the last sorted population.
+     */
+    void sortPopulations(Ions& ions, GridLayout const& layout);
+
+    auto& sorter() const { return sorter_; }
+
+
+    /** In UpdaterMode::domain_only, particles are pushed out of place and the populations keep
+     * their time n particles. This then gives, for the population of the given index, the pushed
+     * domain particles and the patch ghost particles entering the domain that are out of the
+     * domain box shrunk by the particle ghost width, which are all the neighbour patches need to
+     * compute their moment ghosts.
+     */
+    ParticleArray& predictedParticles(std::size_t popIndex)
+    {
+        return scratch_[popIndex].predicted;
+    }
+
+    ScratchStats scratchStats() const
+    {
+        auto stats = scratchStats_;
+        for (auto const& scratch : scratch_)
+            stats.nbrParticles += scratch.pushed.capacity() + scratch.patchGhost.capacity()
+                                  + scratch.levelGhost.capacity() + scratch.predicted.capacity();
+        return stats;
+    }
+
+
 private:
-    void updateAndDepositDomain_(Ions& ions, Electromag const& em, GridLayout const& layout);
+    void setMeshAndTimeStep_(GridLayout const& layout, double dt)
+    {
+        pusher_->setMeshAndTimeStep(layout.meshSize(), dt);
+        for (auto& pusher : chunkPushers_)
+            pusher->setMeshAndTimeStep(layout.meshSize(), dt);
+    }
+
+    // with aside, only the border domain particles are pushed, see updateBorder()
+    void updateAndDepositDomain_(Ions& ions, Electromag const& em, GridLayout const& layout,
+                                 AsideParticles* aside = nullptr);
+
+    void updateAndDepositAll_(Ions& ions, Electromag const& em, GridLayout const& layout,
+                              AsideParticles* aside = nullptr);
+
+
+    /** pushes the particles [first, last) of inParticles into the same indexes of outParticles,
+     * which can be the same array, and deposits the moments of those kept by the selector as
+     * they are pushed, see Pusher::moveAndDeposit(). Returns the end of the kept particles,
+     * which are moved at the beginning of the range, the others following them.
+     */
+    template<typename Population, typename Selector>
+    PartIterator pushAndDepositDomain_(ParticleArray& inParticles, ParticleArray& outParticles,
+                                       std::size_t first, std::size_t last, Population& pop,
+                                       Electromag const& em, Selector const& selector,
+                                       GridLayout const& layout);
+
+
+    static Box shrunk_(Box box, std::size_t width)
+    {
+        for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+        {
+            box.lower[iDim] += static_cast<int>(width);
+            box.upper[iDim] -= static_cast<int>(width);
+        }
+        return box;
+    }
+
+    /** moves the bulk particles, which cannot reach the ghost box of a neighbour patch in a
+     * step, in front of the others, and returns their number
+     */
+    std::size_t partitionBulk_(ParticleArray& particles, GridLayout const& layout) const
+    {
+        auto const bulkBox = shrunk_(layout.AMRBox(), GridLayout::ghostWidthForParticles() + 1);
+        auto firstBorder   = std::partition(std::begin(particles), std::end(particles),
+                                          [&bulkBox](auto const& part) {
+                                              return core::isIn(cellAsPoint(part), bulkBox);
+                                          });
+        return static_cast<std::size_t>(std::distance(std::begin(particles), firstBorder));
+    }
 
-    void updateAndDepositAll_(Ions& ions, Electromag const& em, GridLayout const& layout);
+    // boundaries of the chunks of [0, size) given to the threads
+    std::vector<std::size_t> const& chunks_(std::size_t size)
+    {
+        chunkBounds_.resize(threadPool_.size() + 1);
+        for (std::size_t i = 0; i < chunkBounds_.size(); ++i)
+            chunkBounds_[i] = i * size / threadPool_.size();
+        return chunkBounds_;
+    }
+
+
+    // grows the capacity of the array to at least the given size, with some headroom so that
+    // slowly growing arrays do not reallocate at each step
+    void reserve_(ParticleArray& particles, std::size_t size)
+    {
+        if (particles.capacity() < size)
+        {
+            particles.reserve(size + size / 8);
+            ++scratchStats_.nbrAllocations;
+        }
+    }
 };
 
 
@@ -78,7 +316,7 @@ void IonUpdater<Ions, Electromag, GridLayout>::updatePopulations(Ions& ions, Ele
     PHARE_LOG_SCOPE("IonUpdater::updatePopulations");
 
     resetMoments(ions);
-    pusher_->setMeshAndTimeStep(layout.meshSize(), dt);
+    setMeshAndTimeStep_(layout, dt);
 
     if (mode == UpdaterMode::domain_only)
     {
@@ -102,14 +340,184 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateIons(Ions& ions, GridLayout
 
 
 
+template<typename Ions, typename Electromag, typename GridLayout>
+void IonUpdater<Ions, Electromag, GridLayout>::updateBorder(Ions& ions, Electromag const& em,
+                                                            GridLayout const& layout, double dt,
+                                                            UpdaterMode mode,
+                                                            AsideParticles& aside)
+{
+    PHARE_LOG_SCOPE("IonUpdater::updateBorder");
+
+    aside.domain.resize(ions.nbrPopulations());
+    aside.patchGhost.resize(ions.nbrPopulations());
+    aside.border.resize(ions.nbrPopulations());
+    aside.nbrBulk.resize(ions.nbrPopulations());
+
+    resetMoments(ions);
+    setMeshAndTimeStep_(layout, dt);
+
+    if (mode == UpdaterMode::domain_only)
+    {
+        updateAndDepositDomain_(ions, em, layout, &aside);
+        setAside(ions, aside);
+    }
+    else
+    {
+        updateAndDepositAll_(ions, em, layout, &aside);
+    }
+}
+
+
+
+template<typename Ions, typename Electromag, typename GridLayout>
+void IonUpdater<Ions, Electromag, GridLayout>::updateBulk(Ions& ions, Electromag const& em,
+                                                          GridLayout const& layout, double dt,
+                                                          UpdaterMode mode, AsideParticles& aside)
+{
+    PHARE_LOG_SCOPE("IonUpdater::updateBulk");
+
+    setMeshAndTimeStep_(layout, dt);
+
+    auto const domainBox = layout.AMRBox();
+
+    auto inDomainBox = [&domainBox](auto const& part) {
+        return core::isIn(cellAsPoint(part), domainBox);
+    };
+
+    if (scratch_.size() < ions.nbrPopulations())
+        scratch_.resize(ions.nbrPopulations());
+    std::size_t popIndex = 0;
+
+    for (auto& pop : ions)
+    {
+        auto& timeN        = aside.domain[popIndex];
+        auto const nbrBulk = aside.nbrBulk[popIndex];
+
+        if (mode == UpdaterMode::domain_only)
+        {
+            auto& pushed = scratch_[popIndex].pushed;
+            reserve_(pushed, nbrBulk);
+            pushed.resize(nbrBulk);
+            pushAndDepositDomain_(timeN, pushed, 0, nbrBulk, pop, em, inDomainBox, layout);
+        }
+        else
+        {
+            // border particles, pushed by updateBorder()
+            timeN.erase(std::begin(timeN) + nbrBulk, std::end(timeN));
+            auto firstOutside
+                = pushAndDepositDomain_(timeN, timeN, 0, nbrBulk, pop, em, inDomainBox, layout);
+            timeN.erase(firstOutside, std::end(timeN));
+        }
+        ++popIndex;
+    }
+}
+
+
+
+template<typename Ions, typename Electromag, typename GridLayout>
+void IonUpdater<Ions, Electromag, GridLayout>::mergeBulk(Ions& ions, AsideParticles& aside)
+{
+    std::size_t popIndex = 0;
+    for (auto& pop : ions)
+    {
+        auto& domain = pop.domainParticles();
+        auto& bulk   = aside.domain[popIndex++];
+
+        reserve_(bulk, bulk.size() + domain.size());
+        std::copy(std::begin(domain), std::end(domain), std::back_inserter(bulk));
+
+        // the domain array is left aside, with its capacity, for the next updateBorder()
+        domain.swap(bulk);
+        bulk.clear();
+    }
+}
+
+
+
+template<typename Ions, typename Electromag, typename GridLayout>
+double IonUpdater<Ions, Electromag, GridLayout>::maxCellCrossing(Ions const& ions,
+                                                                 Electromag const& em,
+                                                                 GridLayout const& layout,
+                                                                 double dt) const
+{
+    // interpolation weights are positive and sum to 1, so the electric field at a particle is
+    // bounded by the largest components of E on the patch
+    double maxE2 = 0;
+    for (auto component : {Component::X, Component::Y, Component::Z})
+    {
+        auto const& Ei  = em.E.getComponent(component);
+        auto const data = Ei.data();
+        double maxEi    = 0;
+        for (std::size_t i = 0; i < Ei.size(); ++i)
+            maxEi = std::max(maxEi, std::abs(data[i]));
+        maxE2 += maxEi * maxEi;
+    }
+
+    auto const& meshSize = layout.meshSize();
+    auto const minDl     = *std::min_element(std::begin(meshSize), std::end(meshSize));
+
+    // the Boris rotation keeps |v|, the two electric half kicks add at most |q/m||E|dt
+    double maxCrossing = 0;
+    for (auto const& pop : ions)
+    {
+        double maxV2 = 0, maxCharge = 0;
+        for (auto const& particle : pop.domainParticles())
+        {
+            auto const& v = particle.v;
+            maxV2         = std::max(maxV2, v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            maxCharge     = std::max(maxCharge, std::abs(particle.charge));
+        }
+        auto const maxV = std::sqrt(maxV2) + maxCharge / pop.mass() * std::sqrt(maxE2) * dt;
+        maxCrossing     = std::max(maxCrossing, maxV * dt / minDl);
+    }
+    return maxCrossing;
+}
+
+
+
+template<typename Ions, typename Electromag, typename GridLayout>
+void IonUpdater<Ions, Electromag, GridLayout>::setAside(Ions& ions, AsideParticles& aside)
+{
+    aside.domain.resize(ions.nbrPopulations());
+    aside.patchGhost.resize(ions.nbrPopulations());
+
+    std::size_t popIndex = 0;
+    for (auto& pop : ions)
+    {
+        // patch ghost arrays are emptied and refilled by the messenger
+        aside.domain[popIndex].swap(pop.domainParticles());
+        aside.patchGhost[popIndex].swap(pop.patchGhostParticles());
+        pop.domainParticles().swap(predictedParticles(popIndex));
+        ++popIndex;
+    }
+}
+
+
+
+template<typename Ions, typename Electromag, typename GridLayout>
+void IonUpdater<Ions, Electromag, GridLayout>::sortPopulations(Ions& ions,
+                                                               GridLayout const& layout)
+{
+    PHARE_LOG_SCOPE("IonUpdater::sortPopulations");
+
+    auto domainBox = layout.AMRBox();
+
+    for (auto& pop : ions)
+        sorter_(pop.domainParticles(), domainBox);
+}
+
+
+
 template<typename Ions, typename Electromag, typename GridLayout>
 /**
  * @brief IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_
-   evolves moments from time n to n+1 without updating particles, which stay at time n
+   evolves moments from time n to n+1 without updating particles, which stay at time n.
+   Particles are pushed in scratch arrays, see predictedParticles()
  */
 void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_(Ions& ions,
                                                                        Electromag const& em,
-                                                                       GridLayout const& layout)
+                                                                       GridLayout const& layout,
+                                                                       AsideParticles* aside)
 {
     PHARE_LOG_SCOPE("IonUpdater::updateAndDepositDomain_");
 
@@ -129,37 +537,48 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_(Ions& ion
         return core::isIn(cell, ghostBox) and !core::isIn(cell, domainBox);
     };
 
+    // particles in this box cannot be in the ghost box of any neighbour patch
+    auto const interiorBox = shrunk_(domainBox, partGhostWidth);
+
+    auto neededByNeighbours = [&interiorBox](auto const& part) {
+        return !core::isIn(cellAsPoint(part), interiorBox);
+    };
+
+
+    if (scratch_.size() < ions.nbrPopulations())
+        scratch_.resize(ions.nbrPopulations());
+    std::size_t popIndex = 0;
 
     for (auto& pop : ions)
     {
         ParticleArray& domain = pop.domainParticles();
-        ParticleArray tmpPatchGhost;
-        ParticleArray tmpLevelGhost;
+        auto& scratch         = scratch_[popIndex];
 
-        // first push all domain particles
+        // first push all domain particles, or only those of the border, the bulk ones being
+        // left to updateBulk()
         // push them while still inDomainBox
         // accumulate those inDomainBox
 
-        auto inRange
-            = makeRange(std::begin(pop.domainParticles()), std::end(pop.domainParticles()));
-        auto outRange = makeRange(std::begin(domain), std::end(domain));
-
-        auto newEnd
-            = pusher_->move(inRange, outRange, em, pop.mass(), interpolator_, inDomainBox, layout);
+        auto const first
+            = aside ? aside->nbrBulk[popIndex] = partitionBulk_(domain, layout) : std::size_t{0};
+        ++popIndex;
 
-        interpolator_(std::begin(domain), newEnd, pop.density(), pop.flux(), layout);
+        reserve_(scratch.pushed, domain.size());
+        scratch.pushed.resize(domain.size());
+        pushAndDepositDomain_(domain, scratch.pushed, first, domain.size(), pop, em, inDomainBox,
+                              layout);
 
         // then push patch and level ghost particles
         // push those in the ghostArea (i.e. stop pushing if they're not out of it)
         // some will leave the ghost area
         // deposit moments on those which leave to go inDomainBox
 
-        auto pushAndAccumulateGhosts = [&](auto& inputArray, auto& outputArray,
-                                           bool copyInDomain = false) {
+        auto pushAndAccumulateGhosts = [&](auto& inputArray, auto& outputArray) {
+            reserve_(outputArray, inputArray.size());
             outputArray.resize(inputArray.size());
 
-            inRange  = makeRange(std::begin(inputArray), std::end(inputArray));
-            outRange = makeRange(std::begin(outputArray), std::end(outputArray));
+            auto inRange  = makeRange(std::begin(inputArray), std::end(inputArray));
+            auto outRange = makeRange(std::begin(outputArray), std::end(outputArray));
 
             auto firstGhostOut = pusher_->move(inRange, outRange, em, pop.mass(), interpolator_,
                                                ghostSelector, layout);
@@ -168,20 +587,38 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_(Ions& ion
 
             interpolator_(firstGhostOut, endInDomain, pop.density(), pop.flux(), layout);
 
-            if (copyInDomain)
-                std::copy(firstGhostOut, endInDomain, std::back_inserter(domain));
+            return makeRange(std::move(firstGhostOut), std::move(endInDomain));
         };
 
-        // After this function is done domain particles overlaping ghost layers of neighbor patches
-        // are sent to these neighbor's patchghost particle array.
+        // After this function is done predicted domain particles overlaping ghost layers of
+        // neighbor patches are sent to these neighbor's patchghost particle array.
         // After being pushed, some patch ghost particles may enter the domain. These need to be
-        // copied into the domain array so they are transfered to the neighbor patch
+        // copied into the predicted array so they are transfered to the neighbor patch
         // ghost array and contribute to moments there too.
         // On the contrary level ghost particles entering the domain here do not need to be copied
         // since they contribute to nodes that are not shared with neighbor patches an since
         // level border nodes will receive contributions from levelghost old and new particles
-        pushAndAccumulateGhosts(pop.patchGhostParticles(), tmpPatchGhost, true);
-        pushAndAccumulateGhosts(pop.levelGhostParticles(), tmpLevelGhost);
+        auto enteringPatchGhosts
+            = pushAndAccumulateGhosts(pop.patchGhostParticles(), scratch.patchGhost);
+        pushAndAccumulateGhosts(pop.levelGhostParticles(), scratch.levelGhost);
+
+        auto copyPredicted = [&](auto&& range) {
+            std::copy_if(std::begin(range), std::end(range),
+                         std::back_inserter(scratch.predicted), neededByNeighbours);
+        };
+        auto countPredicted = [&](auto&& range) {
+            return static_cast<std::size_t>(
+                std::count_if(std::begin(range), std::end(range), neededByNeighbours));
+        };
+
+        auto pushedRange
+            = makeRange(std::begin(scratch.pushed) + first, std::end(scratch.pushed));
+
+        scratch.predicted.clear();
+        reserve_(scratch.predicted,
+                 countPredicted(pushedRange) + countPredicted(enteringPatchGhosts));
+        copyPredicted(pushedRange);
+        copyPredicted(enteringPatchGhosts);
     }
 }
 
@@ -193,7 +630,8 @@ template<typename Ions, typename Electromag, typename GridLayout>
  */
 void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositAll_(Ions& ions,
                                                                     Electromag const& em,
-                                                                    GridLayout const& layout)
+                                                                    GridLayout const& layout,
+                                                                    AsideParticles* aside)
 {
     PHARE_LOG_SCOPE("IonUpdater::updateAndDepositAll_");
 
@@ -211,42 +649,174 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositAll_(Ions& ions,
         = [&domainBox](auto const& part) { return core::isIn(cellAsPoint(part), domainBox); };
 
 
-    // push domain particles, erase from array those leaving domain
+    // push domain particles and deposit those staying in domain, erase from array the others
     // push patch and level ghost particles that are in ghost area (==ghost box without domain)
     // copy patch and ghost particles out of ghost area that are in domain, in particle array
-    // finally all particles in domain are to be interpolated on mesh.
+    // finally these entering particles are to be interpolated on mesh.
+    // with aside, only border domain particles are pushed, and kept in the border array with the
+    // entering particles, which then becomes the domain array, see updateBorder()
 
+    std::size_t popIndex = 0;
 
     for (auto& pop : ions)
     {
-        auto& domainParticles = pop.domainParticles();
+        auto& domain = pop.domainParticles();
+        auto const first
+            = aside ? aside->nbrBulk[popIndex] = partitionBulk_(domain, layout) : std::size_t{0};
+
+        auto firstOutside = pushAndDepositDomain_(domain, domain, first, domain.size(), pop, em,
+                                                  inDomainSelector, layout);
+
+        auto& domainParticles = aside ? aside->border[popIndex] : domain;
+        if (aside)
+        {
+            domainParticles.clear();
+            reserve_(domainParticles, static_cast<std::size_t>(std::distance(
+                                          std::begin(domain) + first, firstOutside)));
+            std::copy(std::begin(domain) + first, firstOutside,
+                      std::back_inserter(domainParticles));
+        }
+        else
+        {
+            domainParticles.erase(firstOutside, std::end(domainParticles));
+        }
+        auto const nbrPushed = domainParticles.size();
+
+
+        auto pushGhosts = [&](auto& particleArray) {
+            auto range = makeRange(std::begin(particleArray), std::end(particleArray));
+            return pusher_->move(range, range, em, pop.mass(), interpolator_, ghostSelector,
+                                 layout);
+        };
 
-        auto domainPartRange = makeRange(std::begin(domainParticles), std::end(domainParticles));
+        auto copyInDomain = [&](auto& particleArray, auto firstOutGhostBox) {
+            std::copy_if(firstOutGhostBox, std::end(particleArray),
+                         std::back_inserter(domainParticles), inDomainSelector);
 
-        auto firstOutside = pusher_->move(domainPartRange, domainPartRange, em, pop.mass(),
-                                          interpolator_, inDomainSelector, layout);
+            particleArray.erase(firstOutGhostBox, std::end(particleArray));
+        };
 
-        domainParticles.erase(firstOutside, std::end(domainParticles));
+        auto countInDomain = [&](auto& particleArray, auto firstOutGhostBox) {
+            return static_cast<std::size_t>(
+                std::count_if(firstOutGhostBox, std::end(particleArray), inDomainSelector));
+        };
 
 
-        auto pushAndCopyInDomain = [&](auto& particleArray) {
-            auto range = makeRange(std::begin(particleArray), std::end(particleArray));
-            auto firstOutGhostBox
-                = pusher_->move(range, range, em, pop.mass(), interpolator_, ghostSelector, layout);
+        auto& patchGhosts = pop.patchGhostParticles();
+        auto& levelGhosts = pop.levelGhostParticles();
 
-            std::copy_if(firstOutGhostBox, std::end(particleArray),
-                         std::back_inserter(domainParticles), inDomainSelector);
+        auto firstPatchGhostOut = pushGhosts(patchGhosts);
+        auto firstLevelGhostOut = pushGhosts(levelGhosts);
 
-            particleArray.erase(firstOutGhostBox, std::end(particleArray));
+        // domain arrays grow once for all entering particles, not as they are appended
+        reserve_(domainParticles, domainParticles.size()
+                                      + countInDomain(patchGhosts, firstPatchGhostOut)
+                                      + countInDomain(levelGhosts, firstLevelGhostOut));
+
+        copyInDomain(patchGhosts, firstPatchGhostOut);
+        copyInDomain(levelGhosts, firstLevelGhostOut);
+
+        interpolator_(std::begin(domainParticles) + nbrPushed, std::end(domainParticles),
+                      pop.density(), pop.flux(), layout);
+
+        if (aside)
+        {
+            aside->domain[popIndex].swap(domain);
+            domain.swap(domainParticles);
+        }
+        ++popIndex;
+    }
+}
+
+
+
+/** with several threads, each chunk of particles is pushed and deposited by a thread. The first
+ * chunk deposits on the population moments and the others on their own buffers, which are then
+ * summed in chunk order, so that the result does not depend on which thread pushes which chunk.
+ */
+template<typename Ions, typename Electromag, typename GridLayout>
+template<typename Population, typename Selector>
+auto IonUpdater<Ions, Electromag, GridLayout>::pushAndDepositDomain_(
+    ParticleArray& inParticles, ParticleArray& outParticles, std::size_t first, std::size_t last,
+    Population& pop, Electromag const& em, Selector const& selector, GridLayout const& layout)
+    -> PartIterator
+{
+    auto chunkRange = [first](ParticleArray& particles, std::size_t begin, std::size_t end) {
+        return makeRange(std::begin(particles) + first + begin,
+                         std::begin(particles) + first + end);
+    };
+
+    if (threadPool_.size() == 1)
+    {
+        auto inRange  = chunkRange(inParticles, 0, last - first);
+        auto outRange = chunkRange(outParticles, 0, last - first);
+        auto deposit  = [&](PartIterator first, PartIterator last) {
+            interpolator_(first, last, pop.density(), pop.flux(), layout);
         };
+        return pusher_->moveAndDeposit(inRange, outRange, em, pop.mass(), interpolator_, selector,
+                                       deposit, layout);
+    }
+
+    auto const& bounds = chunks_(last - first);
+    auto& ends         = chunkEnds_;
+    ends.resize(threadPool_.size());
+    chunkMoments_.resize(threadPool_.size());
+
+    for (std::size_t iChunk = 1; iChunk < chunkMoments_.size(); ++iChunk)
+    {
+        auto& moments = chunkMoments_[iChunk];
+        if (!moments or moments->shape != layout.allocSize(HybridQuantity::Scalar::rho))
+        {
+            moments = std::make_unique<ChunkMoments>(layout);
+            ++scratchStats_.nbrAllocations;
+        }
+    }
 
+    threadPool_.parallel_for(ends.size(), [&](std::size_t iChunk, std::size_t threadIdx) {
+        auto& interpolator = chunkInterpolators_[threadIdx];
+
+        Field* density = &pop.density();
+        VecField* flux = &pop.flux();
+        if (iChunk > 0)
+        {
+            auto& moments = *chunkMoments_[iChunk];
+            moments.density.zero();
+            moments.flux.zero();
+            density = &moments.density;
+            flux    = &moments.flux;
+        }
+
+        auto deposit = [&](PartIterator first, PartIterator last) {
+            interpolator(first, last, *density, *flux, layout);
+        };
 
-        pushAndCopyInDomain(pop.patchGhostParticles());
-        pushAndCopyInDomain(pop.levelGhostParticles());
+        auto inRange  = chunkRange(inParticles, bounds[iChunk], bounds[iChunk + 1]);
+        auto outRange = chunkRange(outParticles, bounds[iChunk], bounds[iChunk + 1]);
+        ends[iChunk]  = chunkPushers_[threadIdx]->moveAndDeposit(
+            inRange, outRange, em, pop.mass(), interpolator, selector, deposit, layout);
+    });
+
+    // kept particles of each chunk are rotated in front of the particles left by the previous
+    // chunks, which are still needed in UpdaterMode::domain_only
+    auto newEnd = ends[0];
+    for (std::size_t iChunk = 1; iChunk < ends.size(); ++iChunk)
+        newEnd = std::rotate(newEnd, std::begin(outParticles) + first + bounds[iChunk],
+                             ends[iChunk]);
+
+    auto sum = [](Field& field, Field const& chunkField) {
+        std::transform(std::begin(field), std::end(field), std::begin(chunkField),
+                       std::begin(field), std::plus<double>{});
+    };
 
-        interpolator_(std::begin(domainParticles), std::end(domainParticles), pop.density(),
-                      pop.flux(), layout);
+    for (std::size_t iChunk = 1; iChunk < chunkMoments_.size(); ++iChunk)
+    {
+        auto& moments = *chunkMoments_[iChunk];
+        sum(pop.density(), moments.density);
+        for (auto component : {Component::X, Component::Y, Component::Z})
+            sum(pop.flux().getComponent(component), moments.flux.getComponent(component));
     }
+
+    return newEnd;
 }
 
 
@@ -26,8 +26,12 @@ namespace core
         using Super = Pusher<dim, ParticleIterator, Electromag, Interpolator, BoundaryCondition,
                              GridLayout>;
         using ParticleSelector = typename Super::ParticleSelector;
+        using ParticleDeposit  = typename Super::ParticleDeposit;
         using ParticleRange    = Range<ParticleIterator>;
 
+        //! number of particles pushed, selected and deposited together by moveAndDeposit()
+        static constexpr std::size_t block_size = 256;
+
     private:
     public:
         // This move function should be considered when being used so that all particles are pushed
@@ -53,12 +57,9 @@ namespace core
 
             rangeOut = makeRange(rangeOut.begin(), std::move(newEnd));
 
-            // get electromagnetic fields interpolated on the particles of rangeOut
-            // stop at newEnd.
-            interpolator(rangeOut.begin(), rangeOut.end(), emFields, layout);
-
-            // get the particle velocity from t=n to t=n+1
-            accelerate_(rangeOut, rangeOut, mass);
+            // get the particle velocity from t=n to t=n+1, electromagnetic fields
+            // are interpolated on the particles of rangeOut as we go
+            accelerate_(rangeOut, emFields, interpolator, layout, mass);
 
             // now advance the particles from t=n+1/2 to t=n+1 using v_{n+1} just calculated
             // and get a pointer to the first leaving particle
@@ -88,12 +89,9 @@ namespace core
             //   particles consistent. see: https://github.com/PHAREHUB/PHARE/issues/571
             pushStep_(rangeIn, rangeOut, PushStep::PrePush);
 
-            // get electromagnetic fields interpolated on the particles of rangeOut
-            // stop at newEnd.
-            interpolator(rangeOut.begin(), rangeOut.end(), emFields, layout);
-
-            // get the particle velocity from t=n to t=n+1
-            accelerate_(rangeOut, rangeOut, mass);
+            // get the particle velocity from t=n to t=n+1, electromagnetic fields
+            // are interpolated on the particles of rangeOut as we go
+            accelerate_(rangeOut, emFields, interpolator, layout, mass);
 
             // now advance the particles from t=n+1/2 to t=n+1 using v_{n+1} just calculated
             // and get a pointer to the first leaving particle
@@ -106,6 +104,59 @@ namespace core
         }
 
 
+        /** see Pusher::moveAndDeposit() documentation
+         *
+         * Particles are pushed of a full step by blocks small enough to stay in cache, then
+         * selected and deposited before the next block is read. Selected particles are moved in
+         * front of the others as blocks are done, in the order of rangeIn.
+         */
+        ParticleIterator moveAndDeposit(ParticleRange const& rangeIn, ParticleRange& rangeOut,
+                                        Electromag const& emFields, double mass,
+                                        Interpolator& interpolator,
+                                        ParticleSelector const& particleIsNotLeaving,
+                                        ParticleDeposit const& deposit,
+                                        GridLayout const& layout) override
+        {
+            PHARE_LOG_SCOPE("Boris::moveAndDeposit");
+
+            std::size_t const nbrParticles = rangeIn.size();
+            auto pivot                     = rangeOut.begin();
+
+            for (std::size_t start = 0; start < nbrParticles; start += block_size)
+            {
+                auto const first = static_cast<std::ptrdiff_t>(start);
+                auto const last
+                    = static_cast<std::ptrdiff_t>(std::min(start + block_size, nbrParticles));
+
+                auto blockIn  = makeRange(rangeIn.begin() + first, rangeIn.begin() + last);
+                auto blockOut = makeRange(rangeOut.begin() + first, rangeOut.begin() + last);
+
+                // same steps as move(), without partitioning
+                pushStep_(blockIn, blockOut, PushStep::PrePush);
+                accelerate_(blockOut, emFields, interpolator, layout, mass);
+                pushStep_(blockOut, blockOut, PushStep::PostPush);
+
+                auto const firstSelected = pivot;
+                for (auto it = blockOut.begin(); it != blockOut.end(); ++it)
+                {
+                    if (particleIsNotLeaving(*it))
+                    {
+                        if (pivot != it)
+                            std::iter_swap(pivot, it);
+                        ++pivot;
+                    }
+                }
+
+                if (firstSelected != pivot)
+                    deposit(firstSelected, pivot);
+            }
+
+            rangeOut = makeRange(rangeOut.begin(), std::move(pivot));
+
+            return rangeOut.end();
+        }
+
+
         /** see Pusher::move() documentation*/
         virtual void setMeshAndTimeStep(std::array<double, dim> ms, double ts) override
         {
@@ -121,8 +172,8 @@ namespace core
 
         /** move the particle partIn of half a time step and store it in partOut
          */
-        template<typename ParticleIter>
-        void advancePosition_(ParticleIter const& partIn, ParticleIter& partOut)
+        template<typename ParticleIn, typename ParticleOut>
+        void advancePosition_(ParticleIn const& partIn, ParticleOut&& partOut)
         {
             // push the particle
             for (std::size_t iDim = 0; iDim < dim; ++iDim)
@@ -151,7 +202,7 @@ namespace core
         void pushStep_(ParticleRangeIn const& rangeIn, ParticleRangeOut& rangeOut, PushStep step)
         {
             auto currentOut = rangeOut.begin();
-            for (auto& currentIn : rangeIn)
+            for (auto const& currentIn : rangeIn)
             {
                 // in the first push, this is the first time
                 // we push to rangeOut, which contains crap
@@ -190,32 +241,35 @@ namespace core
 
 
 
-        /** Accelerate the particles in rangeIn and put the new velocity in rangeOut
+        /** Accelerate the particles in range, the electromagnetic field is interpolated
+         * on each particle right before it is used so that it is never stored
          */
-        template<typename ParticleRangeIn, typename ParticleRangeOut>
-        void accelerate_(ParticleRangeIn inputParticles, ParticleRangeOut outputParticles,
-                         double mass)
+        template<typename ParticleRange_>
+        void accelerate_(ParticleRange_& range, Electromag const& emFields,
+                         Interpolator& interpolator, GridLayout const& layout, double mass)
         {
             double dto2m = 0.5 * dt_ / mass;
 
-            auto currentOut = outputParticles.begin();
-
-            for (auto const& currentIn : inputParticles)
+            for (auto&& particle : range)
             {
-                double coef1 = currentIn.charge * dto2m;
+                auto const& [E, B]       = interpolator(particle, emFields, layout);
+                auto const& [Ex, Ey, Ez] = E;
+                auto const& [Bx, By, Bz] = B;
+
+                double coef1 = particle.charge * dto2m;
 
                 // We now apply the 3 steps of the BORIS PUSHER
 
                 // 1st half push of the electric field
-                double velx1 = currentIn.v[0] + coef1 * currentIn.Ex;
-                double vely1 = currentIn.v[1] + coef1 * currentIn.Ey;
-                double velz1 = currentIn.v[2] + coef1 * currentIn.Ez;
+                double velx1 = particle.v[0] + coef1 * Ex;
+                double vely1 = particle.v[1] + coef1 * Ey;
+                double velz1 = particle.v[2] + coef1 * Ez;
 
 
                 // preparing variables for magnetic rotation
-                double const rx = coef1 * currentIn.Bx;
-                double const ry = coef1 * currentIn.By;
-                double const rz = coef1 * currentIn.Bz;
+                double const rx = coef1 * Bx;
+                double const ry = coef1 * By;
+                double const rz = coef1 * Bz;
 
                 double const rx2  = rx * rx;
                 double const ry2  = ry * ry;
@@ -247,16 +301,14 @@ namespace core
 
 
                 // 2nd half push of the electric field
-                velx1 = velx2 + coef1 * currentIn.Ex;
-                vely1 = vely2 + coef1 * currentIn.Ey;
-                velz1 = velz2 + coef1 * currentIn.Ez;
+                velx1 = velx2 + coef1 * Ex;
+                vely1 = vely2 + coef1 * Ey;
+                velz1 = velz2 + coef1 * Ez;
 
                 // Update particle velocity
-                currentOut->v[0] = velx1;
-                currentOut->v[1] = vely1;
-                currentOut->v[2] = velz1;
-
-                ++currentOut;
+                particle.v[0] = velx1;
+                particle.v[1] = vely1;
+                particle.v[2] = velz1;
             }
         }
 
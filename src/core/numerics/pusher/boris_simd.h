@@ -0,0 +1,401 @@
+#ifndef PHARE_CORE_PUSHER_BORIS_SIMD_H
+#define PHARE_CORE_PUSHER_BORIS_SIMD_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+
+#include "core/numerics/pusher/pusher.h"
+#include "core/utilities/range/range.h"
+#include "core/utilities/types.h"
+#include "core/logger.h"
+
+
+namespace PHARE::core
+{
+/** BorisSimdPusher implements the same scheme as BorisPusher, but particles are
+ * processed by batches of PHARE_SIMD_BATCH_SIZE. Each batch is loaded in a small
+ * structure of arrays on the stack, on which the position and velocity kernels are
+ * branchless fixed-size loops that the compiler vectorizes.
+ * Operations are done in the same order as in BorisPusher.
+ */
+template<std::size_t dim, typename ParticleIterator, typename Electromag, typename Interpolator,
+         typename BoundaryCondition, typename GridLayout>
+class BorisSimdPusher
+    : public Pusher<dim, ParticleIterator, Electromag, Interpolator, BoundaryCondition, GridLayout>
+{
+public:
+    using Super
+        = Pusher<dim, ParticleIterator, Electromag, Interpolator, BoundaryCondition, GridLayout>;
+    using ParticleSelector = typename Super::ParticleSelector;
+    using ParticleDeposit  = typename Super::ParticleDeposit;
+    using ParticleRange    = Range<ParticleIterator>;
+
+    static constexpr std::size_t batch_size = PHARE_SIMD_BATCH_SIZE;
+
+
+    /** see Pusher::move() documentation*/
+    ParticleIterator move(ParticleRange const& rangeIn, ParticleRange& rangeOut,
+                          Electromag const& emFields, double mass, Interpolator& interpolator,
+                          ParticleSelector const& particleIsNotLeaving, BoundaryCondition& bc,
+                          GridLayout const& layout) override
+    {
+        auto firstLeaving = pushStep_(rangeIn, rangeOut, particleIsNotLeaving, PushStep::PrePush);
+        auto newEnd       = bc.applyOutgoingParticleBC(firstLeaving, rangeOut.end());
+        rangeOut          = makeRange(rangeOut.begin(), std::move(newEnd));
+
+        accelerate_(rangeOut, emFields, interpolator, layout, mass);
+
+        firstLeaving = pushStep_(rangeOut, rangeOut, particleIsNotLeaving, PushStep::PostPush);
+        newEnd       = bc.applyOutgoingParticleBC(firstLeaving, rangeOut.end());
+        rangeOut     = makeRange(rangeOut.begin(), std::move(newEnd));
+
+        return rangeOut.end();
+    }
+
+
+    /** see Pusher::move() documentation*/
+    ParticleIterator move(ParticleRange const& rangeIn, ParticleRange& rangeOut,
+                          Electromag const& emFields, double mass, Interpolator& interpolator,
+                          ParticleSelector const& particleIsNotLeaving,
+                          GridLayout const& layout) override
+    {
+        PHARE_LOG_SCOPE("BorisSimd::move_no_bc");
+
+        // no partition on the first half step, see BorisPusher::move
+        pushStep_(rangeIn, rangeOut, PushStep::PrePush);
+
+        accelerate_(rangeOut, emFields, interpolator, layout, mass);
+
+        auto firstLeaving
+            = pushStep_(rangeOut, rangeOut, particleIsNotLeaving, PushStep::PostPush);
+
+        rangeOut = makeRange(rangeOut.begin(), std::move(firstLeaving));
+
+        return rangeOut.end();
+    }
+
+
+    /** see Pusher::moveAndDeposit() documentation
+     *
+     * Each batch is pushed of a full step, selected and deposited while it is in cache, so that
+     * particles are read and written once instead of once per step of move(). Selected particles
+     * are moved in front of the others as batches are written, in the order of rangeIn.
+     */
+    ParticleIterator moveAndDeposit(ParticleRange const& rangeIn, ParticleRange& rangeOut,
+                                    Electromag const& emFields, double mass,
+                                    Interpolator& interpolator,
+                                    ParticleSelector const& particleIsNotLeaving,
+                                    ParticleDeposit const& deposit,
+                                    GridLayout const& layout) override
+    {
+        PHARE_LOG_SCOPE("BorisSimd::moveAndDeposit");
+
+        double const dto2m  = 0.5 * dt_ / mass;
+        auto const firstOut = rangeOut.begin();
+        auto pivot          = firstOut;
+        std::size_t nbrTooFar{0};
+
+        forEachBatch_(rangeIn.begin(), rangeIn.size(), [&](auto first, std::size_t size) {
+            Batch batch;
+            auto in = first;
+            for (std::size_t i = 0; i < size; ++i, ++in)
+            {
+                auto const& particle = *in;
+                for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                {
+                    batch.iCell[iDim][i] = particle.iCell[iDim];
+                    batch.delta[iDim][i] = particle.delta[iDim];
+                }
+                for (std::size_t iComp = 0; iComp < 3; ++iComp)
+                    batch.v[iComp][i] = particle.v[iComp];
+                batch.charge[i] = particle.charge;
+            }
+
+            auto const out = firstOut + std::distance(rangeIn.begin(), first);
+
+            // fields are gathered at t=n+1/2, from the particles of rangeOut
+            nbrTooFar += advancePosition_(batch);
+            in      = first;
+            auto it = out;
+            for (std::size_t i = 0; i < size; ++i, ++in, ++it)
+            {
+                auto&& particle = *it;
+                particle.charge = (*in).charge;
+                particle.weight = (*in).weight;
+                storePosition_(batch, i, particle);
+            }
+
+            interpolator.gather(out, size, emFields, layout, batch.E, batch.B);
+            accelerate_(batch, dto2m);
+            nbrTooFar += advancePosition_(batch);
+
+            auto const firstSelected = pivot;
+            it                       = out;
+            for (std::size_t i = 0; i < size; ++i, ++it)
+            {
+                auto&& particle = *it;
+                storePosition_(batch, i, particle);
+                for (std::size_t iComp = 0; iComp < 3; ++iComp)
+                    particle.v[iComp] = batch.v[iComp][i];
+
+                if (particleIsNotLeaving(particle))
+                {
+                    if (pivot != it)
+                        std::iter_swap(pivot, it);
+                    ++pivot;
+                }
+            }
+
+            if (firstSelected != pivot)
+                deposit(firstSelected, pivot);
+        });
+
+        if (nbrTooFar > 0)
+        {
+            PHARE_LOG_ERROR("Error, particle moves more than 1 cell, delta >2");
+        }
+
+        rangeOut = makeRange(rangeOut.begin(), std::move(pivot));
+
+        return rangeOut.end();
+    }
+
+
+    /** see Pusher::move() documentation*/
+    void setMeshAndTimeStep(std::array<double, dim> ms, double ts) override
+    {
+        std::transform(std::begin(ms), std::end(ms), std::begin(halfDtOverDl_),
+                       [ts](double& x) { return 0.5 * ts / x; });
+        dt_ = ts;
+    }
+
+
+
+private:
+    enum class PushStep { PrePush, PostPush };
+
+    template<typename T>
+    using lanes_t = std::array<T, batch_size>;
+
+    // lanes past the number of particles in the batch are zeros and never stored back
+    struct Batch
+    {
+        std::array<lanes_t<int>, dim> iCell{};
+        std::array<lanes_t<double>, dim> delta{};
+        std::array<lanes_t<double>, 3> v{}, E{}, B{};
+        lanes_t<double> charge{};
+    };
+
+
+    template<typename Iterator, typename Fn>
+    static void forEachBatch_(Iterator first, std::size_t size, Fn&& fn)
+    {
+        for (std::size_t start = 0; start < size; start += batch_size)
+        {
+            auto const nbrParticles = std::min(batch_size, size - start);
+            fn(first + static_cast<std::ptrdiff_t>(start), nbrParticles);
+        }
+    }
+
+
+    /** vectorized equivalent of BorisPusher::advancePosition_
+     * @return the number of particles that moved more than one cell
+     */
+    std::size_t advancePosition_(Batch& batch) const
+    {
+        std::size_t nbrTooFar = 0;
+
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            auto& delta        = batch.delta[iDim];
+            auto& iCell        = batch.iCell[iDim];
+            auto const& v      = batch.v[iDim];
+            auto const halfDtl = halfDtOverDl_[iDim];
+
+            for (std::size_t i = 0; i < batch_size; ++i)
+            {
+                double const newDelta = delta[i] + static_cast<double>(halfDtl * v[i]);
+                double const newCell  = std::floor(newDelta);
+                nbrTooFar += std::abs(newDelta) > 2;
+                delta[i] = newDelta - newCell;
+                iCell[i] = static_cast<int>(newCell + iCell[i]);
+            }
+        }
+        return nbrTooFar;
+    }
+
+
+    /** vectorized equivalent of the velocity update of BorisPusher::accelerate_ */
+    void accelerate_(Batch& batch, double dto2m) const
+    {
+        auto& [vx, vy, vz]       = batch.v;
+        auto const& [Ex, Ey, Ez] = batch.E;
+        auto const& [Bx, By, Bz] = batch.B;
+
+        for (std::size_t i = 0; i < batch_size; ++i)
+        {
+            double const coef1 = batch.charge[i] * dto2m;
+
+            // 1st half push of the electric field
+            double const velx1 = vx[i] + coef1 * Ex[i];
+            double const vely1 = vy[i] + coef1 * Ey[i];
+            double const velz1 = vz[i] + coef1 * Ez[i];
+
+            // preparing variables for magnetic rotation
+            double const rx = coef1 * Bx[i];
+            double const ry = coef1 * By[i];
+            double const rz = coef1 * Bz[i];
+
+            double const rx2  = rx * rx;
+            double const ry2  = ry * ry;
+            double const rz2  = rz * rz;
+            double const rxry = rx * ry;
+            double const rxrz = rx * rz;
+            double const ryrz = ry * rz;
+
+            double const invDet = 1. / (1. + rx2 + ry2 + rz2);
+
+            // preparing rotation matrix due to the magnetic field
+            // m = invDet*(I + r*r - r x I) - I where x denotes the cross product
+            double const mxx = 1. + rx2 - ry2 - rz2;
+            double const mxy = 2. * (rxry + rz);
+            double const mxz = 2. * (rxrz - ry);
+
+            double const myx = 2. * (rxry - rz);
+            double const myy = 1. + ry2 - rx2 - rz2;
+            double const myz = 2. * (ryrz + rx);
+
+            double const mzx = 2. * (rxrz + ry);
+            double const mzy = 2. * (ryrz - rx);
+            double const mzz = 1. + rz2 - rx2 - ry2;
+
+            // magnetic rotation
+            double const velx2 = (mxx * velx1 + mxy * vely1 + mxz * velz1) * invDet;
+            double const vely2 = (myx * velx1 + myy * vely1 + myz * velz1) * invDet;
+            double const velz2 = (mzx * velx1 + mzy * vely1 + mzz * velz1) * invDet;
+
+            // 2nd half push of the electric field
+            vx[i] = velx2 + coef1 * Ex[i];
+            vy[i] = vely2 + coef1 * Ey[i];
+            vz[i] = velz2 + coef1 * Ez[i];
+        }
+    }
+
+
+
+    template<typename Particle>
+    static void storePosition_(Batch const& batch, std::size_t i, Particle&& particle)
+    {
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            particle.iCell[iDim] = batch.iCell[iDim][i];
+            particle.delta[iDim] = batch.delta[iDim][i];
+        }
+    }
+
+
+    template<typename ParticleRangeIn, typename ParticleRangeOut>
+    void pushStep_(ParticleRangeIn const& rangeIn, ParticleRangeOut& rangeOut, PushStep step)
+    {
+        auto const firstOut = rangeOut.begin();
+        std::size_t nbrTooFar{0};
+
+        forEachBatch_(rangeIn.begin(), rangeIn.size(), [&](auto first, std::size_t size) {
+            Batch batch;
+            auto in = first;
+            for (std::size_t i = 0; i < size; ++i, ++in)
+            {
+                auto const& particle = *in;
+                for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                {
+                    batch.iCell[iDim][i] = particle.iCell[iDim];
+                    batch.delta[iDim][i] = particle.delta[iDim];
+                }
+                for (std::size_t iComp = 0; iComp < 3; ++iComp)
+                    batch.v[iComp][i] = particle.v[iComp];
+            }
+
+            nbrTooFar += advancePosition_(batch);
+
+            auto out = firstOut + std::distance(rangeIn.begin(), first);
+            in       = first;
+            for (std::size_t i = 0; i < size; ++i, ++in, ++out)
+            {
+                auto&& particle = *out;
+                // see BorisPusher::pushStep_, rangeOut needs the state of rangeIn
+                if (step == PushStep::PrePush)
+                {
+                    auto const& particleIn = *in;
+                    particle.charge        = particleIn.charge;
+                    particle.weight        = particleIn.weight;
+                    particle.v             = particleIn.v;
+                }
+                for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                {
+                    particle.iCell[iDim] = batch.iCell[iDim][i];
+                    particle.delta[iDim] = batch.delta[iDim][i];
+                }
+            }
+        });
+
+        if (nbrTooFar > 0)
+        {
+            PHARE_LOG_ERROR("Error, particle moves more than 1 cell, delta >2");
+        }
+    }
+
+
+    template<typename ParticleRangeIn, typename ParticleRangeOut>
+    auto pushStep_(ParticleRangeIn const& rangeIn, ParticleRangeOut& rangeOut,
+                   ParticleSelector const& particleIsNotLeaving, PushStep step)
+    {
+        pushStep_(rangeIn, rangeOut, step);
+
+        return std::partition(std::begin(rangeOut), std::end(rangeOut), particleIsNotLeaving);
+    }
+
+
+    template<typename ParticleRange_>
+    void accelerate_(ParticleRange_& range, Electromag const& emFields,
+                     Interpolator& interpolator, GridLayout const& layout, double mass)
+    {
+        double const dto2m = 0.5 * dt_ / mass;
+
+        forEachBatch_(range.begin(), range.size(), [&](auto first, std::size_t size) {
+            Batch batch;
+            interpolator.gather(first, size, emFields, layout, batch.E, batch.B);
+
+            auto it = first;
+            for (std::size_t i = 0; i < size; ++i, ++it)
+            {
+                auto const& particle = *it;
+                for (std::size_t iComp = 0; iComp < 3; ++iComp)
+                    batch.v[iComp][i] = particle.v[iComp];
+                batch.charge[i] = particle.charge;
+            }
+
+            accelerate_(batch, dto2m);
+
+            it = first;
+            for (std::size_t i = 0; i < size; ++i, ++it)
+            {
+                auto&& particle = *it;
+                for (std::size_t iComp = 0; iComp < 3; ++iComp)
+                    particle.v[iComp] = batch.v[iComp][i];
+            }
+        });
+    }
+
+
+
+    std::array<double, dim> halfDtOverDl_;
+    double dt_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <utility>
+#include <iterator>
 #include <functional>
 
 #include "core/utilities/range/range.h"
@@ -19,7 +20,11 @@ namespace core
     protected:
         using ParticleRange             = Range<ParticleIterator>;
         static auto constexpr dimension = GridLayout::dimension;
-        using ParticleSelector          = std::function<bool(Particle<dimension> const&)>;
+        // for contiguous particle arrays, the iterator reference is a view on the particle
+        using ParticleRef_t = std::remove_reference_t<
+            typename std::iterator_traits<ParticleIterator>::reference>;
+        using ParticleSelector = std::function<bool(ParticleRef_t const&)>;
+        using ParticleDeposit  = std::function<void(ParticleIterator, ParticleIterator)>;
 
     public:
         /** Move all particles in rangeIn from t=n to t=n+1 and store their new
@@ -67,6 +72,26 @@ namespace core
             = 0;
 
 
+        /** pushes particles as the move() overload without boundary condition does, and calls
+         * deposit on the particles for which the selector returns true, by consecutive ranges
+         * covering [rangeOut.begin, pivot[.
+         *
+         * Pushers that can push, select and deposit particles in a single pass override it,
+         * the default moves all particles then deposits the selected ones.
+         */
+        virtual ParticleIterator
+        moveAndDeposit(ParticleRange const& rangeIn, ParticleRange& rangeOut,
+                       Electromag const& emFields, double mass, Interpolator& interpolator,
+                       ParticleSelector const& particleIsNotLeaving,
+                       ParticleDeposit const& deposit, GridLayout const& layout)
+        {
+            auto pivot = move(rangeIn, rangeOut, emFields, mass, interpolator,
+                              particleIsNotLeaving, layout);
+            deposit(rangeOut.begin(), pivot);
+            return pivot;
+        }
+
+
         /**
          * @brief setMeshAndTimeStep allows to let the pusher know what is the mesh
          * size and time step in the domain where particles are to be pushed.
@@ -6,6 +6,7 @@
 #include <string>
 
 #include "boris.h"
+#include "boris_simd.h"
 #include "pusher.h"
 
 namespace PHARE
@@ -17,7 +18,9 @@ namespace core
     public:
         template<std::size_t dim, typename ParticleIterator, typename Electromag,
                  typename Interpolator, typename BoundaryCondition, typename GridLayout>
-        static auto makePusher(std::string pusherName)
+        static std::unique_ptr<Pusher<dim, ParticleIterator, Electromag, Interpolator,
+                                      BoundaryCondition, GridLayout>>
+        makePusher(std::string pusherName)
         {
             if (pusherName == "modified_boris")
             {
@@ -25,6 +28,13 @@ namespace core
                                                     BoundaryCondition, GridLayout>>();
             }
 
+            if (pusherName == "modified_boris_simd")
+            {
+                return std::make_unique<BorisSimdPusher<dim, ParticleIterator, Electromag,
+                                                        Interpolator, BoundaryCondition,
+                                                        GridLayout>>();
+            }
+
             throw std::runtime_error("Error : Invalid Pusher name");
         }
     };
@@ -0,0 +1,74 @@
+#ifndef PHARE_CORE_UTILITIES_BOX_CELL_INDEXER_H
+#define PHARE_CORE_UTILITIES_BOX_CELL_INDEXER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/utilities/box/box.h"
+
+
+namespace PHARE::core
+{
+/** CellIndexer gives the cells of a box flat indexes from 0 to size() - 1, and size() to the
+ * cells outside the box.
+ *
+ * Cells are numbered with the last direction varying fastest, as field nodes in NdArrayVector,
+ * or with the first direction varying fastest if firstDirectionFastest, as SAMRAI cell data.
+ */
+template<std::size_t dim, bool firstDirectionFastest = false>
+class CellIndexer
+{
+public:
+    using Box_t = Box<int, dim>;
+
+    CellIndexer() = default;
+
+    explicit CellIndexer(Box_t const& box) { reset(box); }
+
+
+    void reset(Box_t const& box)
+    {
+        box_  = box;
+        size_ = 1;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            shape_[iDim] = static_cast<std::uint32_t>(box.upper[iDim] - box.lower[iDim] + 1);
+            size_ *= shape_[iDim];
+        }
+    }
+
+
+    Box_t const& box() const { return box_; }
+
+    /** @return the number of cells of the box */
+    std::size_t size() const { return size_; }
+
+
+    template<typename Cell>
+    std::size_t operator()(Cell const& cell) const
+    {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < dim; ++i)
+        {
+            auto const iDim  = firstDirectionFastest ? dim - 1 - i : i;
+            auto const local = cell[iDim] - box_.lower[iDim];
+            if (local < 0 or local >= static_cast<int>(shape_[iDim]))
+                return size_;
+            index = index * shape_[iDim] + static_cast<std::size_t>(local);
+        }
+        return index;
+    }
+
+
+
+private:
+    Box_t box_;
+    std::array<std::uint32_t, dim> shape_{};
+    std::size_t size_ = 0;
+};
+
+} // namespace PHARE::core
+
+
+#endif
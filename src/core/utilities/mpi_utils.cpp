@@ -34,4 +34,12 @@ bool any(bool b)
     return global_sum > 0;
 }
 
+
+std::vector<bool> any(std::vector<bool> const& local)
+{
+    std::vector<int> values(local.begin(), local.end());
+    MPI_Allreduce(MPI_IN_PLACE, values.data(), values.size(), MPI_INT, MPI_LOR, MPI_COMM_WORLD);
+    return std::vector<bool>(values.begin(), values.end());
+}
+
 } // namespace PHARE::core::mpi
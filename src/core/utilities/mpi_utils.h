@@ -27,6 +27,9 @@ std::size_t max(std::size_t const local, int mpi_size = 0);
 
 bool any(bool);
 
+// element wise any
+std::vector<bool> any(std::vector<bool> const&);
+
 int size();
 
 int rank();
@@ -0,0 +1,114 @@
+#ifndef PHARE_CORE_UTILITIES_PHILOX_H
+#define PHARE_CORE_UTILITIES_PHILOX_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+
+namespace PHARE::core
+{
+/** Philox4x32 is the Philox4x32-10 counter-based random generator (Salmon et al., "Parallel
+ * random numbers: as easy as 1, 2, 3", SC11).
+ *
+ * Its output is a bijection of a 128 bit counter under a 64 bit key: a generator is made of a
+ * key and the first three counter words, the "stream", and draws by incrementing the fourth.
+ * Streams of the same key are independent, so that the numbers drawn for an entity only depend
+ * on the entity, and not on when or by which thread they are drawn.
+ *
+ * It is a UniformRandomBitGenerator, usable with the distributions of <random>.
+ */
+class Philox4x32
+{
+public:
+    using Key         = std::array<std::uint32_t, 2>;
+    using Stream      = std::array<std::uint32_t, 3>;
+    using Counter     = std::array<std::uint32_t, 4>;
+    using result_type = std::uint64_t;
+
+    Philox4x32(Key const& key, Stream const& stream)
+        : key_{key}
+        , counter_{stream[0], stream[1], stream[2], 0}
+    {
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        if (next_ == 2)
+        {
+            block_ = bijection(counter_, key_);
+            ++counter_[3];
+            next_ = 0;
+        }
+        auto const i = 2 * next_++;
+        return (static_cast<result_type>(block_[i]) << 32) | block_[i + 1];
+    }
+
+
+    static Counter bijection(Counter counter, Key key)
+    {
+        for (std::size_t round = 0; round < 10; ++round)
+        {
+            if (round > 0)
+            {
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            std::uint64_t const p0 = std::uint64_t{0xD2511F53} * counter[0];
+            std::uint64_t const p1 = std::uint64_t{0xCD9E8D57} * counter[2];
+
+            counter = {static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                       static_cast<std::uint32_t>(p1),
+                       static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                       static_cast<std::uint32_t>(p0)};
+        }
+        return counter;
+    }
+
+
+    // splitmix64 finalizer, to fold keys and streams into few well mixed words
+    static std::uint64_t mix(std::uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+        return value ^ (value >> 31);
+    }
+
+    static std::uint64_t mix(std::uint64_t hash, std::string const& value)
+    {
+        for (char c : value) // FNV-1a, the same on all platforms, unlike std::hash
+            hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3;
+        return mix(hash);
+    }
+
+    static std::uint64_t mix(std::uint64_t hash, double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return mix(hash ^ bits);
+    }
+
+    static Key key(std::uint64_t value)
+    {
+        return {static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32)};
+    }
+
+
+private:
+    Key key_;
+    Counter counter_;
+    Counter block_;
+    std::size_t next_ = 2;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef PHARE_CORE_UTILITIES_TASK_QUEUE_H
+#define PHARE_CORE_UTILITIES_TASK_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+namespace PHARE::core
+{
+/** TaskQueue runs tasks one after the other, in the order they are pushed, on a background
+ * thread.
+ *
+ * At most capacity() tasks wait in the queue: push() blocks while it is full, which bounds
+ * the memory held by tasks that own the data they work on.
+ */
+class TaskQueue
+{
+public:
+    explicit TaskQueue(std::size_t capacity)
+        : capacity_{capacity > 0 ? capacity : 1}
+        , worker_{[this]() { work_(); }}
+    {
+    }
+
+    TaskQueue(TaskQueue const&) = delete;
+    TaskQueue& operator=(TaskQueue const&) = delete;
+
+    /** runs the remaining tasks before returning, errors they throw are lost */
+    ~TaskQueue()
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            idle_.wait(lock, [this]() { return tasks_.empty() and !running_; });
+            stop_ = true;
+        }
+        pushed_.notify_one();
+        worker_.join();
+    }
+
+
+    std::size_t capacity() const { return capacity_; }
+
+
+    /** queues task, blocking while the queue is full.
+     * rethrows the first exception thrown by a previous task, if any.
+     */
+    void push(std::function<void()> task)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            popped_.wait(lock, [this]() { return tasks_.size() < capacity_; });
+            rethrow_();
+            tasks_.push_back(std::move(task));
+        }
+        pushed_.notify_one();
+    }
+
+
+    /** returns once all pushed tasks are done, and rethrows the first exception they threw */
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        idle_.wait(lock, [this]() { return tasks_.empty() and !running_; });
+        rethrow_();
+    }
+
+
+
+private:
+    void rethrow_()
+    {
+        if (error_)
+        {
+            auto error = error_;
+            error_     = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+
+    void work_()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                pushed_.wait(lock, [this]() { return stop_ or !tasks_.empty(); });
+                if (stop_)
+                    return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+                running_ = true;
+            }
+            popped_.notify_one();
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (!error_)
+                    error_ = std::current_exception();
+            }
+            task = nullptr; // what the task owns is released before wait() returns
+
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                running_ = false;
+            }
+            idle_.notify_all();
+        }
+    }
+
+
+
+    std::size_t const capacity_;
+    std::deque<std::function<void()>> tasks_;
+
+    std::mutex mutex_;
+    std::condition_variable pushed_;
+    std::condition_variable popped_;
+    std::condition_variable idle_;
+    std::exception_ptr error_;
+    bool running_ = false;
+    bool stop_    = false;
+
+    std::thread worker_; // last, so that it starts once all other members are constructed
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef PHARE_CORE_UTILITIES_THREAD_POOL_H
+#define PHARE_CORE_UTILITIES_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace PHARE::core
+{
+/** ThreadPool runs loops of independent iterations on a fixed set of threads.
+ *
+ * The thread calling parallel_for() takes part in the loop as thread 0, so a pool of size 1
+ * starts no thread and runs loops serially. Iterations are handed out one at a time, which
+ * suits loops of few heavy iterations such as patch loops.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(std::size_t nbrThreads)
+        : nbrThreads_{nbrThreads > 0 ? nbrThreads : 1}
+    {
+        for (std::size_t threadIdx = 1; threadIdx < nbrThreads_; ++threadIdx)
+            workers_.emplace_back([this, threadIdx]() { work_(threadIdx); });
+    }
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+
+    std::size_t size() const { return nbrThreads_; }
+
+
+    /** a pool of size 1, shared by the callers that have no pool of their own */
+    static ThreadPool& serial()
+    {
+        static ThreadPool pool{1};
+        return pool;
+    }
+
+
+    /** calls fn(i, threadIdx) for i in [0, size), with threadIdx in [0, this->size()).
+     * returns once all iterations are done, and rethrows the first exception thrown by fn.
+     */
+    template<typename Fn>
+    void parallel_for(std::size_t size, Fn&& fn)
+    {
+        if (nbrThreads_ == 1 or size < 2)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                fn(i, std::size_t{0});
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        auto loop = [&](std::size_t threadIdx) {
+            for (auto i = next++; i < size; i = next++)
+                fn(i, threadIdx);
+        };
+        job_ = std::ref(loop); // a std::function does not allocate to hold a reference
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            ++generation_;
+            nbrRunning_ = workers_.size();
+            error_      = nullptr;
+        }
+        start_.notify_all();
+
+        run_(0);
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        done_.wait(lock, [this]() { return nbrRunning_ == 0; });
+        job_ = nullptr;
+
+        if (error_)
+            std::rethrow_exception(error_);
+    }
+
+
+
+private:
+    void run_(std::size_t threadIdx)
+    {
+        try
+        {
+            job_(threadIdx);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!error_)
+                error_ = std::current_exception();
+        }
+    }
+
+
+    void work_(std::size_t threadIdx)
+    {
+        std::size_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                start_.wait(lock, [&]() { return stop_ or generation_ != generation; });
+                if (stop_)
+                    return;
+                generation = generation_;
+            }
+
+            run_(threadIdx);
+
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                --nbrRunning_;
+            }
+            done_.notify_one();
+        }
+    }
+
+
+
+    std::size_t const nbrThreads_;
+    std::vector<std::thread> workers_;
+    std::function<void(std::size_t)> job_;
+
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::size_t generation_ = 0;
+    std::size_t nbrRunning_ = 0;
+    std::exception_ptr error_;
+    bool stop_ = false;
+};
+
+} // namespace PHARE::core
+
+
+#endif
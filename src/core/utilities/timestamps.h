@@ -39,13 +39,15 @@ private:
 
 struct TimeStamperFactory
 {
-    static std::unique_ptr<ITimeStamper> create(initializer::PHAREDict const& dict)
+    /** init_idx is the number of steps already done, when restarting */
+    static std::unique_ptr<ITimeStamper> create(initializer::PHAREDict const& dict,
+                                                std::size_t const init_idx = 0)
     {
         assert(dict.contains("time_step"));
         auto time_step = dict["time_step"].template to<double>();
 
         // only option for the moment
-        return std::make_unique<ConstantTimeStamper>(time_step);
+        return std::make_unique<ConstantTimeStamper>(time_step, init_idx);
     }
 };
 
@@ -23,6 +23,12 @@
 #define _PHARE_TO_STR(x) #x // convert macro text to string
 #define PHARE_TO_STR(x) _PHARE_TO_STR(x)
 
+#if !defined(PHARE_SIMD_BATCH_SIZE)
+// number of particles processed at once by batched kernels
+// 8 doubles fill an AVX-512 register, or two AVX2 registers
+#define PHARE_SIMD_BATCH_SIZE 8
+#endif
+
 namespace PHARE
 {
 namespace core
@@ -110,6 +110,15 @@ struct HighFiveFile
         file_.getDataSet(path).write(pointer_dim_caster<dim>(data));
         return *this;
     }
+
+    // writes the count values of data to the hyperslab of the dataset starting at offset
+    template<typename T>
+    auto& write_data_set_slab(std::string const& path, std::vector<std::size_t> const& offset,
+                              std::vector<std::size_t> const& count, T const* data)
+    {
+        file_.getDataSet(path).select(offset, count).write_raw(data);
+        return *this;
+    }
 };
 
 
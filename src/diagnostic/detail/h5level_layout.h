@@ -0,0 +1,293 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_H5LEVEL_LAYOUT_H
+#define PHARE_DIAGNOSTIC_DETAIL_H5LEVEL_LAYOUT_H
+
+#include "h5manifest.h"
+
+#include "core/utilities/types.h"
+
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * In the level layout, the datasets of the patches of a level are concatenated into one
+ * dataset per quantity, and the attributes and dataset shapes of the patches become rows of
+ * index tables, so that a dump holds a few large datasets instead of several per patch:
+ *
+ * /t#/pl#/<quantity>           the flattened data of all patches of the level, in patch order
+ * /t#/pl#/shapes/<quantity>    the shape of the data of each patch
+ * /t#/pl#/patches/<attribute>  the attributes of each patch, and its "id" (owner, local id)
+ *
+ * Patches are ordered by MPI rank, then in the order the process visits them. Each process
+ * writes the data of all its patches with a single hyperslab write per dataset, at the offset
+ * the Manifest gives to its part of the dataset.
+ */
+class LevelLayout
+{
+    using Bytes = std::vector<char>;
+
+public:
+    explicit LevelLayout(Manifest& manifest)
+        : manifest_{manifest}
+    {
+    }
+
+    void start()
+    {
+        slabs_.clear();
+        slabIndex_.clear();
+        patches_.clear();
+        attributes_.clear();
+    }
+
+
+    // the dataset at path, in a patch group, becomes a part of the dataset of the level
+    template<typename Type>
+    void addDataSet(HiFile& file, std::string const& path, std::vector<std::size_t> const& shape,
+                    DataSetOptions const& options = {})
+    {
+        auto const patchPath = split_(path);
+        if (!patchPath)
+            throw std::runtime_error("LevelLayout: dataset outside of a patch " + path);
+
+        addPatch_(file, *patchPath);
+        addRow_(file, patchPath->level + "/shapes/" + patchPath->rest, shape);
+
+        auto& slab   = slab_<Type>(file, patchPath->level + "/" + patchPath->rest);
+        slab.options = options;
+        slab.rows += size_(shape);
+    }
+
+
+    // attributes of patch groups become rows of the index tables of the level
+    template<typename Data>
+    void addAttribute(HiFile& file, std::string const& path, std::string const& key,
+                      Data const& value)
+    {
+        auto const patchPath = split_(path);
+        if (!patchPath)
+            return manifest_.addAttribute(file, path, key, value);
+
+        addPatch_(file, *patchPath);
+        if (patchPath->rest.empty())
+            return addRow_(file, patchPath->level + "/patches/" + key, value);
+
+        // patches share the attributes of the level dataset, e.g. the ghosts
+        auto const levelPath = patchPath->level + "/" + patchPath->rest;
+        if (attributes_.emplace(&file, levelPath + "/" + key).second)
+            manifest_.addAttribute(file, levelPath, key, value);
+    }
+
+
+    // records the parts of the current process to the manifest, before it creates the datasets
+    void record()
+    {
+        for (auto const& slab : slabs_)
+            slab.addPart(manifest_, *slab.file, slab.path, slab.rows, slab.rowShape,
+                         slab.options);
+    }
+
+
+    // stages the data of the dataset at path, in a patch group, for write()
+    template<typename T>
+    void append(HiFile& file, std::string const& path, T const* data, std::size_t size)
+    {
+        auto const patchPath = split_(path);
+        if (!patchPath)
+            throw std::runtime_error("LevelLayout: dataset outside of a patch " + path);
+
+        auto& slab = slabs_.at(slabIndex_.at({&file, patchPath->level + "/" + patchPath->rest}));
+        append_(slab, data, size);
+    }
+
+
+    // calls run with, for each dataset of the dump, a task writing the staged data
+    template<typename Run>
+    void write(Run&& run)
+    {
+        for (auto& slab : slabs_)
+        {
+            if (slab.rows == 0)
+                continue;
+
+            std::vector<std::size_t> offset(slab.rowShape.size() + 1, 0);
+            std::vector<std::size_t> count{slab.rows};
+            offset[0] = manifest_.partOffset(*slab.file, slab.path);
+            count.insert(count.end(), slab.rowShape.begin(), slab.rowShape.end());
+
+            auto staged = std::make_shared<Slab>(std::move(slab));
+            if (staged->bytes.size() != staged->elementSize * size_(count))
+                throw std::runtime_error("LevelLayout: missing data for " + staged->path);
+
+            run([staged, offset, count]() {
+                staged->write(*staged->file, staged->path, offset, count, staged->bytes.data());
+            });
+        }
+        start();
+    }
+
+
+private:
+    // a "/t/<timestamp>/pl<level>/p<patch>/<rest>" path
+    struct PatchPath
+    {
+        std::string level, patch, rest;
+    };
+
+    struct Slab
+    {
+        HiFile* file = nullptr;
+        std::string path;
+        std::size_t rows = 0;
+        std::vector<std::size_t> rowShape;
+        DataSetOptions options;
+        void (*addPart)(Manifest&, HiFile&, std::string const&, std::size_t,
+                        std::vector<std::size_t> const&, DataSetOptions const&)
+            = nullptr;
+
+        // set with the first staged data, of which the type may differ from the dataset's
+        std::size_t elementSize = 0;
+        void (*write)(HiFile&, std::string const&, std::vector<std::size_t> const&,
+                      std::vector<std::size_t> const&, char const*)
+            = nullptr;
+        Bytes bytes;
+    };
+
+    Manifest& manifest_;
+    std::vector<Slab> slabs_; // in creation order, the same for all dumps of a hierarchy
+    std::map<std::pair<HiFile*, std::string>, std::size_t> slabIndex_;
+    std::set<std::pair<HiFile*, std::string>> patches_;
+    std::set<std::pair<HiFile*, std::string>> attributes_;
+
+
+    static std::size_t size_(std::vector<std::size_t> const& shape)
+    {
+        return std::accumulate(shape.begin(), shape.end(), std::size_t{1},
+                               std::multiplies<std::size_t>());
+    }
+
+
+    static std::optional<PatchPath> split_(std::string const& path)
+    {
+        if (path.empty() or path[0] != '/')
+            return std::nullopt;
+
+        std::vector<std::string> groups;
+        std::size_t begin = 1;
+        for (std::size_t end; (end = path.find('/', begin)) != std::string::npos; begin = end + 1)
+            groups.emplace_back(path.substr(begin, end - begin));
+        groups.emplace_back(path.substr(begin));
+
+        if (groups.size() < 4 or groups[0] != "t"
+            or groups[2].rfind("pl", 0) != 0 or groups[3].rfind("p", 0) != 0)
+            return std::nullopt;
+
+        PatchPath patchPath{"/t/" + groups[1] + "/" + groups[2], groups[3].substr(1), ""};
+        for (std::size_t i = 4; i < groups.size(); ++i)
+            if (!groups[i].empty())
+                patchPath.rest += (patchPath.rest.empty() ? "" : "/") + groups[i];
+        return patchPath;
+    }
+
+
+    template<typename Type>
+    Slab& slab_(HiFile& file, std::string const& path)
+    {
+        auto [it, inserted] = slabIndex_.emplace(std::make_pair(&file, path), slabs_.size());
+        if (inserted)
+        {
+            auto& slab   = slabs_.emplace_back();
+            slab.file    = &file;
+            slab.path    = path;
+            slab.addPart = &addPart_<Type>;
+        }
+        return slabs_[it->second];
+    }
+
+
+    template<typename Data>
+    void addRow_(HiFile& file, std::string const& path, Data const& value)
+    {
+        if constexpr (core::is_std_vector_v<Data>)
+        {
+            auto& slab = slab_<typename Data::value_type>(file, path);
+            if (slab.rows > 0 and slab.rowShape != std::vector<std::size_t>{value.size()})
+                throw std::runtime_error("LevelLayout: rows of different sizes in " + path);
+            slab.rowShape = {value.size()};
+            ++slab.rows;
+            append_(slab, value.data(), value.size());
+        }
+        else if constexpr (std::is_arithmetic_v<Data>)
+        {
+            auto& slab = slab_<Data>(file, path);
+            ++slab.rows;
+            append_(slab, &value, 1);
+        }
+        else
+            throw std::runtime_error("LevelLayout: unsupported patch attribute type in " + path);
+    }
+
+
+    // the id of a patch is written as "owner#local" by SAMRAI
+    void addPatch_(HiFile& file, PatchPath const& patchPath)
+    {
+        if (!patches_.emplace(&file, patchPath.level + "/" + patchPath.patch).second)
+            return;
+
+        auto const sep = patchPath.patch.find('#');
+        if (sep == std::string::npos)
+            throw std::runtime_error("LevelLayout: unexpected patch id " + patchPath.patch);
+
+        addRow_(file, patchPath.level + "/patches/id",
+                std::vector<int>{std::stoi(patchPath.patch.substr(0, sep)),
+                                 std::stoi(patchPath.patch.substr(sep + 1))});
+    }
+
+
+    template<typename T>
+    static void append_(Slab& slab, T const* data, std::size_t size)
+    {
+        if (!slab.write)
+        {
+            slab.elementSize = sizeof(T);
+            slab.write       = &write_<T>;
+        }
+        else if (slab.write != &write_<T>)
+            throw std::runtime_error("LevelLayout: data of different types for " + slab.path);
+
+        auto const* bytes = reinterpret_cast<char const*>(data);
+        slab.bytes.insert(slab.bytes.end(), bytes, bytes + size * sizeof(T));
+    }
+
+
+    template<typename Type>
+    static void addPart_(Manifest& manifest, HiFile& file, std::string const& path,
+                         std::size_t rows, std::vector<std::size_t> const& rowShape,
+                         DataSetOptions const& options)
+    {
+        manifest.addDataSetPart<Type>(file, path, rows, rowShape, options);
+    }
+
+    template<typename T>
+    static void write_(HiFile& file, std::string const& path,
+                       std::vector<std::size_t> const& offset,
+                       std::vector<std::size_t> const& count, char const* bytes)
+    {
+        file.getDataSet(path).select(offset, count).write_raw(reinterpret_cast<T const*>(bytes));
+    }
+};
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_H5LEVEL_LAYOUT_H */
@@ -0,0 +1,455 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_H5MANIFEST_H
+#define PHARE_DIAGNOSTIC_DETAIL_H5MANIFEST_H
+
+#include "highfive/H5DataSpace.hpp"
+#include "highfive/H5File.hpp"
+#include "highfive/H5PropertyList.hpp"
+
+#include "core/utilities/mpi_utils.h"
+#include "core/utilities/types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace PHARE::diagnostic::h5
+{
+using HiFile = HighFive::File;
+
+
+namespace
+{ // during attribute/dataset creation, we currently don't require the parents of the group to
+  // exist, but create all that are missing - this used to exist in highfive
+    inline std::string getParentName(const std::string& path)
+    {
+        std::size_t idx = path.find_last_of("/");
+        if (idx == std::string::npos or idx == 0)
+            return "/";
+        return path.substr(0, idx);
+    }
+
+    inline void createGroupsToDataSet(HiFile& file, const std::string& path)
+    {
+        std::string group_name = getParentName(path);
+        if (!file.exist(group_name))
+            file.createGroup(group_name);
+    }
+} // namespace
+
+
+
+// creation properties of a dataset, which must be the same for all processes
+struct DataSetOptions
+{
+    // rows of the first dimension per chunk, 0 being contiguous unless compressed
+    std::size_t chunkRows = 0;
+    std::uint8_t deflate  = 0; // compression level, 0 being uncompressed
+
+    static constexpr std::size_t default_chunk_rows = 1 << 16;
+
+    bool operator==(DataSetOptions const& that) const
+    {
+        return chunkRows == that.chunkRows and deflate == that.deflate;
+    }
+};
+
+
+
+/*
+ * HDF5 requires all MPI processes to create all datasets and attributes of a file, including
+ * the ones holding the data of other processes. During a dump, the Manifest records the datasets
+ * and attributes of the current process, and create() exchanges the records of all processes in
+ * a single collective, after which each process creates them all, in the same order.
+ *
+ * The records of a file are kept from one dump to the next, without the timestamp of their
+ * path. A file is only exchanged again if a process records something different for it, which
+ * for fields only happens when the hierarchy changes.
+ *
+ * A dataset part is a number of rows of a dataset shared by processes: the dataset is created
+ * with the rows of all processes, in rank order, and partOffset() gives the first row of the
+ * part of the current process.
+ */
+class Manifest
+{
+    // types of dataset values and attributes
+    using Types = std::tuple<int, std::uint32_t, std::size_t, float, double, std::string,
+                             std::vector<int>, std::vector<std::uint32_t>,
+                             std::vector<std::size_t>, std::vector<double>>;
+
+    enum class Record : std::uint8_t { DataSet, Attribute, DataSetPart };
+
+    using Bytes = std::vector<char>;
+
+public:
+    // timestampPath: the group of the current dump, removed from recorded paths
+    void start(std::string const& timestampPath)
+    {
+        timestampPath_ = timestampPath;
+        records_.clear();
+    }
+
+
+    // empty datasets, e.g. of patches without particles, are not created
+    template<typename Type>
+    void addDataSet(HiFile& file, std::string const& path, std::vector<std::size_t> const& shape,
+                    DataSetOptions const& options = {})
+    {
+        if (shape.empty()
+            or std::any_of(shape.begin(), shape.end(), [](auto const& s) { return s == 0; }))
+            return;
+
+        auto& bytes = records_[&file];
+        write_(bytes, Record::DataSet);
+        write_(bytes, tag_<Type>());
+        writePath_(bytes, path);
+        write_(bytes, shape);
+        writeOptions_(bytes, options);
+    }
+
+
+    // rowShape: the shape of one row, empty for a one dimensional dataset
+    template<typename Type>
+    void addDataSetPart(HiFile& file, std::string const& path, std::size_t rows,
+                        std::vector<std::size_t> const& rowShape,
+                        DataSetOptions const& options = {})
+    {
+        if (rows == 0)
+            return;
+
+        auto& bytes = records_[&file];
+        write_(bytes, Record::DataSetPart);
+        write_(bytes, tag_<Type>());
+        writePath_(bytes, path);
+        write_(bytes, rows);
+        write_(bytes, rowShape);
+        writeOptions_(bytes, options);
+    }
+
+
+    template<typename Data>
+    void addAttribute(HiFile& file, std::string const& path, std::string const& key,
+                      Data const& value)
+    {
+        if (path.empty())
+            return;
+
+        auto& bytes = records_[&file];
+        write_(bytes, Record::Attribute);
+        write_(bytes, tag_<Data>());
+        writePath_(bytes, path);
+        write_(bytes, key);
+        write_(bytes, value);
+    }
+
+
+    // collective, files must be given in the same order by all processes
+    void create(std::vector<HiFile*> const& files);
+
+
+    // the first row of the part of the current process in the dataset at path, after create()
+    std::size_t partOffset(HiFile& file, std::string const& path) const
+    {
+        return partOffsets_.at(&file).at(path);
+    }
+
+
+private:
+    struct Exchanged
+    {
+        Bytes local;              // records of the current process
+        std::vector<Bytes> ranks; // records of each process
+    };
+
+    std::string timestampPath_;
+    std::unordered_map<HiFile*, Bytes> records_;
+    std::unordered_map<std::string, Exchanged> exchanged_; // per file name
+    std::unordered_map<HiFile*, std::unordered_map<std::string, std::size_t>> partOffsets_;
+
+    struct Part
+    {
+        std::string path;
+        std::uint8_t tag;
+        std::vector<std::size_t> rowShape;
+        DataSetOptions options;
+        std::size_t rows = 0; // of all processes
+    };
+
+
+    template<typename T, std::size_t I = 0>
+    static constexpr std::uint8_t tag_()
+    {
+        static_assert(I < std::tuple_size_v<Types>, "type not supported in manifests");
+        if constexpr (std::is_same_v<T, std::tuple_element_t<I, Types>>)
+            return I;
+        else
+            return tag_<T, I + 1>();
+    }
+
+    // calls fn with a value of the type of tag
+    template<std::size_t I = 0, typename Fn>
+    static void visitTag_(std::uint8_t tag, Fn&& fn)
+    {
+        if constexpr (I < std::tuple_size_v<Types>)
+        {
+            if (tag == I)
+                fn(std::tuple_element_t<I, Types>{});
+            else
+                visitTag_<I + 1>(tag, fn);
+        }
+        else
+            throw std::runtime_error("Manifest: unknown type tag");
+    }
+
+
+    template<typename T>
+    static void write_(Bytes& bytes, T const& value)
+    {
+        if constexpr (std::is_same_v<T, std::string> or core::is_std_vector_v<T>)
+        {
+            write_(bytes, value.size());
+            auto const* data = reinterpret_cast<char const*>(value.data());
+            bytes.insert(bytes.end(), data, data + value.size() * sizeof(*value.data()));
+        }
+        else
+        {
+            auto const* data = reinterpret_cast<char const*>(&value);
+            bytes.insert(bytes.end(), data, data + sizeof(T));
+        }
+    }
+
+    template<typename T>
+    static T read_(Bytes const& bytes, std::size_t& pos)
+    {
+        T value;
+        if constexpr (std::is_same_v<T, std::string> or core::is_std_vector_v<T>)
+        {
+            value.resize(read_<std::size_t>(bytes, pos));
+            std::size_t const size = value.size() * sizeof(*value.data());
+            std::memcpy(value.data(), &bytes[pos], size);
+            pos += size;
+        }
+        else
+        {
+            std::memcpy(&value, &bytes[pos], sizeof(T));
+            pos += sizeof(T);
+        }
+        return value;
+    }
+
+    // member by member, as padding bytes would differ from a dump to the next
+    static void writeOptions_(Bytes& bytes, DataSetOptions const& options)
+    {
+        write_(bytes, options.chunkRows);
+        write_(bytes, options.deflate);
+    }
+
+    static DataSetOptions readOptions_(Bytes const& bytes, std::size_t& pos)
+    {
+        DataSetOptions options;
+        options.chunkRows = read_<std::size_t>(bytes, pos);
+        options.deflate   = read_<std::uint8_t>(bytes, pos);
+        return options;
+    }
+
+    void writePath_(Bytes& bytes, std::string const& path) const
+    {
+        bool const timed = path.rfind(timestampPath_ + "/", 0) == 0;
+        write_(bytes, timed);
+        write_(bytes, timed ? path.substr(timestampPath_.size()) : path);
+    }
+
+    std::string readPath_(Bytes const& bytes, std::size_t& pos) const
+    {
+        bool const timed = read_<bool>(bytes, pos);
+        auto path        = read_<std::string>(bytes, pos);
+        return timed ? timestampPath_ + path : path;
+    }
+
+
+    void createRecords_(HiFile& file, Bytes const& bytes, Record kind, std::vector<Part>& parts,
+                        bool local);
+
+    template<typename Type>
+    static void createDataSet_(HiFile& file, std::string const& path,
+                               std::vector<std::size_t> const& shape,
+                               DataSetOptions const& options);
+};
+
+
+
+inline void Manifest::create(std::vector<HiFile*> const& files)
+{
+    std::vector<bool> changed(files.size());
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+        auto const& name = files[i]->getName();
+        auto& local      = records_[files[i]];
+        changed[i]       = !exchanged_.count(name) or exchanged_.at(name).local != local;
+    }
+    changed = core::mpi::any(changed);
+
+    // all processes send the records of the same files, each prefixed by its size
+    Bytes sendBuff;
+    for (std::size_t i = 0; i < files.size(); ++i)
+        if (changed[i])
+            write_(sendBuff, records_.at(files[i]));
+
+    if (std::any_of(changed.begin(), changed.end(), [](bool c) { return c; }))
+    {
+        int const mpi_size = core::mpi::size();
+        auto const perRank = core::mpi::collect_raw(sendBuff, mpi_size);
+
+        std::vector<Bytes> rankBytes;
+        for (int rank = 0; rank < mpi_size; ++rank)
+        {
+            auto const span = perRank[rank];
+            rankBytes.emplace_back(span.begin(), span.begin() + span.size());
+        }
+
+        std::vector<std::size_t> pos(mpi_size, 0);
+        for (std::size_t i = 0; i < files.size(); ++i)
+        {
+            if (!changed[i])
+                continue;
+
+            auto& exchanged = exchanged_[files[i]->getName()];
+            exchanged.local = std::move(records_.at(files[i]));
+            exchanged.ranks.resize(mpi_size);
+            for (int rank = 0; rank < mpi_size; ++rank)
+                exchanged.ranks[rank] = read_<Bytes>(rankBytes[rank], pos[rank]);
+        }
+    }
+
+    // datasets first, as attributes may be on datasets
+    partOffsets_.clear();
+    for (auto kind : {Record::DataSet, Record::Attribute})
+        for (auto* file : files)
+        {
+            auto const& ranks = exchanged_.at(file->getName()).ranks;
+            std::vector<Part> parts;
+            for (std::size_t rank = 0; rank < ranks.size(); ++rank)
+                createRecords_(*file, ranks[rank], kind, parts,
+                               rank == static_cast<std::size_t>(core::mpi::rank()));
+
+            for (auto const& part : parts)
+                visitTag_(part.tag, [&](auto const& type) {
+                    using Type = std::decay_t<decltype(type)>;
+                    std::vector<std::size_t> shape{part.rows};
+                    shape.insert(shape.end(), part.rowShape.begin(), part.rowShape.end());
+                    createDataSet_<Type>(*file, part.path, shape, part.options);
+                });
+        }
+}
+
+
+
+inline void Manifest::createRecords_(HiFile& file, Bytes const& bytes, Record kind,
+                                     std::vector<Part>& parts, bool local)
+{
+    std::size_t pos = 0;
+    while (pos < bytes.size())
+    {
+        auto const record = read_<Record>(bytes, pos);
+        auto const tag    = read_<std::uint8_t>(bytes, pos);
+        auto const path   = readPath_(bytes, pos);
+
+        if (record == Record::DataSet)
+        {
+            auto const shape   = read_<std::vector<std::size_t>>(bytes, pos);
+            auto const options = readOptions_(bytes, pos);
+            if (kind == Record::DataSet)
+                visitTag_(tag, [&](auto const& type) {
+                    using Type = std::decay_t<decltype(type)>;
+                    createDataSet_<Type>(file, path, shape, options);
+                });
+            continue;
+        }
+
+        if (record == Record::DataSetPart)
+        {
+            auto const rows     = read_<std::size_t>(bytes, pos);
+            auto const rowShape = read_<std::vector<std::size_t>>(bytes, pos);
+            auto const options  = readOptions_(bytes, pos);
+            if (kind != Record::DataSet)
+                continue;
+
+            auto part = std::find_if(parts.begin(), parts.end(),
+                                     [&](auto const& p) { return p.path == path; });
+            if (part == parts.end())
+                part = parts.insert(parts.end(), Part{path, tag, rowShape, options});
+            else if (part->tag != tag or part->rowShape != rowShape or !(part->options == options))
+                throw std::runtime_error("Manifest: inconsistent parts of dataset " + path);
+
+            if (local)
+                partOffsets_[&file][path] = part->rows;
+            part->rows += rows;
+            continue;
+        }
+
+        auto const key = read_<std::string>(bytes, pos);
+        visitTag_(tag, [&](auto const& type) {
+            using Data       = std::decay_t<decltype(type)>;
+            auto const value = read_<Data>(bytes, pos);
+            if (kind != Record::Attribute)
+                return;
+
+            auto doAttribute = [&](auto node) {
+                if (node.hasAttribute(key))
+                    return;
+                if constexpr (core::is_std_vector_v<Data>)
+                    node.template createAttribute<typename Data::value_type>(
+                            key, HighFive::DataSpace(value.size()))
+                        .write(value.data());
+                else
+                    node.template createAttribute<Data>(key, HighFive::DataSpace::From(value))
+                        .write(value);
+            };
+
+            if (file.exist(path) && file.getObjectType(path) == HighFive::ObjectType::Dataset)
+                doAttribute(file.getDataSet(path));
+            else // group
+            {
+                createGroupsToDataSet(file, path + "/dataset");
+                doAttribute(file.getGroup(path));
+            }
+        });
+    }
+}
+
+
+
+// HDF5 filters only apply to chunked datasets, compressed datasets are chunked by default
+template<typename Type>
+void Manifest::createDataSet_(HiFile& file, std::string const& path,
+                              std::vector<std::size_t> const& shape, DataSetOptions const& options)
+{
+    createGroupsToDataSet(file, path);
+
+    HighFive::DataSetCreateProps props;
+    auto chunkRows = options.chunkRows;
+    if (chunkRows == 0 and options.deflate > 0)
+        chunkRows = DataSetOptions::default_chunk_rows;
+    if (chunkRows > 0)
+    {
+        std::vector<hsize_t> chunk(shape.begin(), shape.end());
+        chunk[0] = std::min<hsize_t>(chunk[0], chunkRows);
+        props.add(HighFive::Chunking(chunk));
+    }
+    if (options.deflate > 0)
+    {
+        props.add(HighFive::Shuffle());
+        props.add(HighFive::Deflate(options.deflate));
+    }
+
+    file.createDataSet<Type>(path, HighFive::DataSpace(shape), props);
+}
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_H5MANIFEST_H */
@@ -26,6 +26,11 @@ public:
     {
     }
 
+    HighFive::File& h5File(DiagnosticProperties const& diagnostic)
+    {
+        return fileData_.at(diagnostic.quantity)->file();
+    }
+
     //------  defined by each concrete H5TypeWriter---------------------------
     virtual void createFiles(DiagnosticProperties& diagnostic) = 0;
 
@@ -61,6 +66,7 @@ public:
 
         if (flushEvery != Writer::flush_never and diagnostic.dumpIdx % flushEvery == 0)
         {
+            h5Writer_.closeFile_(std::move(fileData_.at(diagnostic.quantity)));
             fileData_.erase(diagnostic.quantity);
             assert(fileData_.count(diagnostic.quantity) == 0);
         }
@@ -75,14 +81,8 @@ protected:
     {
         for (std::size_t lvl = h5Writer_.minLevel; lvl <= maxLevel; lvl++)
         {
-            auto& lvlPatches       = patchIDs.at(lvl);
-            std::size_t patchNbr   = lvlPatches.size();
-            std::size_t maxPatches = core::mpi::max(patchNbr);
-            for (std::size_t i = 0; i < patchNbr; ++i)
-                initPatch(lvl, patchAttributes[std::to_string(lvl) + "_" + lvlPatches[i]],
-                          lvlPatches[i]);
-            for (std::size_t i = patchNbr; i < maxPatches; i++)
-                initPatch(lvl, patchAttributes);
+            for (auto const& patchID : patchIDs.at(lvl))
+                initPatch(lvl, patchAttributes[std::to_string(lvl) + "_" + patchID], patchID);
         }
     }
 
@@ -93,17 +93,9 @@ protected:
         std::size_t maxLevel)
     {
         for (std::size_t lvl = h5Writer_.minLevel; lvl <= maxLevel; lvl++)
-        {
-            auto& lvlPatches       = patchAttributes.at(lvl);
-            std::size_t patchNbr   = lvlPatches.size();
-            std::size_t maxPatches = core::mpi::max(patchNbr);
-            for (auto const& [patch, attr] : lvlPatches)
+            for (auto const& [patch, attr] : patchAttributes.at(lvl))
                 h5Writer_.writeAttributeDict(file, attr,
                                              h5Writer_.getPatchPathAddTimestamp(lvl, patch));
-            for (std::size_t i = patchNbr; i < maxPatches; i++)
-                h5Writer_.writeAttributeDict(file, h5Writer_.modelView().getEmptyPatchProperties(),
-                                             "");
-        }
 
         if (diagnostic.nAttributes > 0)
             h5Writer_.writeAttributeDict(file, diagnostic.fileAttributes, "/py_attrs");
@@ -120,11 +112,11 @@ protected:
         h5Writer.writeAttributeDict(file, popAttributes, "/");
     }
 
-    void writeGhostsAttr_(HighFive::File& file, std::string path, std::size_t ghosts, bool null)
+    void writeGhostsAttr_(HighFive::File& file, std::string path, std::size_t ghosts)
     {
         Attributes dsAttr;
         dsAttr["ghosts"] = ghosts;
-        h5Writer_.writeAttributeDict(file, dsAttr, null ? "" : path);
+        h5Writer_.writeAttributeDict(file, dsAttr, path);
     }
 
     template<typename FileMap, typename... Quantities>
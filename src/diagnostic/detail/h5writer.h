@@ -8,15 +8,23 @@
 
 #include "h5typewriter.h"
 #include "h5file.h"
+#include "h5level_layout.h"
+#include "h5manifest.h"
 
 #include "diagnostic/diagnostic_manager.h"
 #include "diagnostic/diagnostic_props.h"
 
 #include "core/data/vecfield/vecfield_component.h"
 #include "core/utilities/mpi_utils.h"
+#include "core/utilities/task_queue.h"
 #include "core/utilities/types.h"
 #include "core/utilities/meta/meta_utilities.h"
 
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
 
 #if !defined(PHARE_DIAG_DOUBLES)
 #error // PHARE_DIAG_DOUBLES not defined
@@ -53,13 +61,25 @@ public:
     // flush_never: disables manual file closing, but still occurrs via RAII
     static constexpr std::size_t flush_never = 0;
 
+    /* asyncQueueSize > 0 makes dump() return once datasets are created and the data to write is
+     * copied, the data being written to the files by a background thread, with at most
+     * asyncQueueSize dataset writes pending
+     *
+     * levelLayout writes one dataset per quantity and level instead of one per patch, see
+     * LevelLayout
+     */
     template<typename Hierarchy, typename Model>
     Writer(Hierarchy& hier, Model& model, std::string const hifivePath,
-           unsigned _flags /* = HiFile::ReadWrite | HiFile::Create | HiFile::Truncate */)
+           unsigned _flags /* = HiFile::ReadWrite | HiFile::Create | HiFile::Truncate */,
+           std::size_t asyncQueueSize = 0, bool levelLayout = false)
         : flags{_flags}
         , filePath_{hifivePath}
         , modelView_{hier, model}
     {
+        if (levelLayout)
+            levelLayout_.emplace(manifest_);
+        if (asyncQueueSize > 0 and asyncIsSupported_())
+            ioQueue_ = std::make_unique<core::TaskQueue>(asyncQueueSize);
     }
 
     ~Writer() {}
@@ -72,7 +92,12 @@ public:
         unsigned flags       = READ_WRITE;
         if (dict.contains("mode") and dict["mode"].template to<std::string>() == "overwrite")
             flags |= HiFile::Truncate;
-        return std::make_unique<This>(hier, model, filePath, flags);
+        std::size_t asyncQueueSize = 0;
+        if (dict.contains("async_queue_size"))
+            asyncQueueSize = dict["async_queue_size"].template to<std::size_t>();
+        bool levelLayout = dict.contains("layout")
+                           and dict["layout"].template to<std::string>() == "level";
+        return std::make_unique<This>(hier, model, filePath, flags, asyncQueueSize, levelLayout);
     }
 
 
@@ -80,6 +105,13 @@ public:
     void dump_level(std::size_t level, std::vector<DiagnosticProperties*> const& diagnostics,
                     double timestamp);
 
+    // returns once the data of previous dumps is written
+    void wait()
+    {
+        if (ioQueue_)
+            ioQueue_->wait();
+    }
+
     template<typename String>
     auto getDiagnosticWriterForType(String& type)
     {
@@ -111,13 +143,23 @@ public:
         return "/t/" + timestamp + "/pl" + std::to_string(iLevel) + "/p" + globalCoords;
     }
 
-    template<typename Type, typename Size>
-    static void createDataSet(HiFile& h5, std::string const& path, Size size)
+    /* the dataset is created for all processes at the end of the metadata phase of the dump,
+     * with the chunking and compression of the diagnostic being initialized.
+     * lossy: doubles are stored as float32 if the diagnostic asks for it
+     */
+    template<typename Type>
+    void createDataSet(HiFile& h5, std::string const& path, std::vector<std::size_t> const& size,
+                       bool lossy = true)
     {
         if constexpr (std::is_same_v<Type, double>) // force doubles for floats for storage
-            This::createDatasetsPerMPI<FloatType>(h5, path, size);
+        {
+            if (lossy and float32_)
+                createDataSet_<float>(h5, path, size);
+            else
+                createDataSet_<FloatType>(h5, path, size);
+        }
         else
-            This::createDatasetsPerMPI<Type>(h5, path, size);
+            createDataSet_<Type>(h5, path, size);
     }
 
 
@@ -130,25 +172,77 @@ public:
             .write(value);
     }
 
+    // attributes are created for all processes with the datasets, an empty path is ignored
     template<typename Dict>
-    static void writeAttributeDict(HiFile& h5, Dict dict, std::string path)
+    void writeAttributeDict(HiFile& h5, Dict dict, std::string path)
     {
         dict.visit([&](std::string const& key, const auto& val) {
-            writeAttributesPerMPI(h5, path, key, val);
+            if (levelLayout_)
+                levelLayout_->addAttribute(h5, path, key, val);
+            else
+                manifest_.addAttribute(h5, path, key, val);
         });
     }
 
-    // per MPI function where path differs per process
-    template<typename Data>
-    static void writeAttributesPerMPI(HiFile& h5, std::string path, std::string key,
-                                      Data const& value);
-
     template<typename VecField>
-    static void writeVecFieldAsDataset(h5::HighFiveFile& h5, std::string path, VecField& vecField)
+    void writeVecFieldAsDataset(h5::HighFiveFile& h5, std::string path, VecField& vecField)
     {
         for (auto& [id, type] : core::Components::componentMap)
-            h5.write_data_set_flat<dimension>(path + "_" + id,
-                                              &(*vecField.getComponent(type).begin()));
+        {
+            auto& component = vecField.getComponent(type);
+            writeDataSet<dimension>(h5, path + "_" + id, &(*component.begin()), component.size());
+        }
+    }
+
+    // writes the size values from data to the dataset at path, now or, if async, in the background
+    template<std::size_t dim, typename T>
+    void writeDataSet(h5::HighFiveFile& h5, std::string const& path, T const* data,
+                      std::size_t size)
+    {
+        if (levelLayout_)
+            levelLayout_->append(h5.file(), path, data, size);
+        else if (!ioQueue_)
+            h5.write_data_set_flat<dim>(path, data);
+        else
+            writeDataSet<dim>(h5, path, std::vector<T>(data, data + size));
+    }
+
+    template<std::size_t dim, typename T>
+    void writeDataSet(h5::HighFiveFile& h5, std::string const& path, std::vector<T>&& data)
+    {
+        if (levelLayout_)
+            levelLayout_->append(h5.file(), path, data.data(), data.size());
+        else if (!ioQueue_)
+            h5.write_data_set_flat<dim>(path, data.data());
+        else
+        {
+            // std::function needs a copyable task, the staged data is not copied
+            auto staged = std::make_shared<std::vector<T>>(std::move(data));
+            ioQueue_->push(
+                [&h5, path, staged]() { h5.write_data_set_flat<dim>(path, staged->data()); });
+        }
+    }
+
+    /* writes rows of rowSize values to the 2d dataset at path, from its row firstRow. rows is
+     * left as is unless written in the background, so that its memory can be reused
+     */
+    template<typename T>
+    void writeDataSetRows(h5::HighFiveFile& h5, std::string const& path, std::size_t firstRow,
+                          std::size_t rowSize, std::vector<T>&& rows)
+    {
+        std::vector<std::size_t> const offset{firstRow, 0}, count{rows.size() / rowSize, rowSize};
+
+        if (levelLayout_) // rows are appended in order
+            levelLayout_->append(h5.file(), path, rows.data(), rows.size());
+        else if (!ioQueue_)
+            h5.write_data_set_slab(path, offset, count, rows.data());
+        else
+        {
+            auto staged = std::make_shared<std::vector<T>>(std::move(rows));
+            ioQueue_->push([&h5, path, offset, count, staged]() {
+                h5.write_data_set_slab(path, offset, count, staged->data());
+            });
+        }
     }
 
     auto& modelView() { return modelView_; }
@@ -161,6 +255,7 @@ private:
     double timestamp_ = 0;
     std::string filePath_;
     std::string patchPath_; // is passed around as "virtual write()" has no parameters
+    std::size_t patchLevel_ = 0;
     ModelView modelView_;
     Attributes fileAttributes_;
 
@@ -171,19 +266,47 @@ private:
         {"electromag", make_writer<ElectromagDiagnosticWriter<This>>()},
         {"particle", make_writer<ParticlesDiagnosticWriter<This>>()}};
 
+    // declared after the writers, so that pending writes are done before their files are closed
+    std::unique_ptr<core::TaskQueue> ioQueue_;
+
     template<typename Writer>
     std::shared_ptr<H5TypeWriter<This>> make_writer()
     {
         return std::make_shared<Writer>(*this);
     }
 
-    template<typename Type, typename Size>
-    static void createDatasetsPerMPI(HiFile& h5, std::string path, Size dataSetSize);
+    Manifest manifest_;
+    std::optional<LevelLayout> levelLayout_;
 
+    // of the diagnostic whose datasets are being created, see patchPath_
+    DataSetOptions dataSetOptions_;
+    bool float32_ = false;
+
+    template<typename Type>
+    void createDataSet_(HiFile& h5, std::string const& path, std::vector<std::size_t> const& size)
+    {
+        if (levelLayout_)
+            levelLayout_->addDataSet<Type>(h5, path, size, dataSetOptions_);
+        else
+            manifest_.addDataSet<Type>(h5, path, size, dataSetOptions_);
+    }
+
+    void setDataSetOptions_(DiagnosticProperties const& diagnostic);
 
     void initializeDatasets_(std::vector<DiagnosticProperties*> const& diagnotics);
     void writeDatasets_(std::vector<DiagnosticProperties*> const& diagnotics);
 
+    // closes the file once the data written to it so far is
+    void closeFile_(std::unique_ptr<HighFiveFile>&& file)
+    {
+        if (!ioQueue_)
+            file.reset();
+        else
+            ioQueue_->push([file = std::shared_ptr<HighFiveFile>{std::move(file)}]() {});
+    }
+
+    static bool asyncIsSupported_();
+
     Writer(const Writer&)             = delete;
     Writer(const Writer&&)            = delete;
     Writer& operator&(const Writer&)  = delete;
@@ -206,6 +329,7 @@ private:
 
 
     const auto& patchPath() const { return patchPath_; }
+    auto patchLevel() const { return patchLevel_; }
     // used by friends end
 };
 
@@ -215,6 +339,9 @@ template<typename ModelView>
 void Writer<ModelView>::dump(std::vector<DiagnosticProperties*> const& diagnostics,
                              double timestamp)
 {
+    // HDF5 is not thread safe, files are only modified here once the background writes are done
+    wait();
+
     timestamp_                     = timestamp;
     fileAttributes_["dimension"]   = dimension;
     fileAttributes_["interpOrder"] = interpOrder;
@@ -222,6 +349,8 @@ void Writer<ModelView>::dump(std::vector<DiagnosticProperties*> const& diagnosti
     fileAttributes_["domain_box"]  = modelView_.domainBox();
     fileAttributes_["cell_width"]  = modelView_.cellWidth();
     fileAttributes_["origin"]      = modelView_.origin();
+    if (levelLayout_)
+        fileAttributes_["layout"] = std::string{"level"};
 
     for (auto* diagnostic : diagnostics)
         if (!file_flags.count(diagnostic->type + diagnostic->quantity))
@@ -256,137 +385,36 @@ void Writer<ModelView>::dump_level(std::size_t level,
 }
 
 
-namespace
-{ // during attribute/dataset creation, we currently don't require the parents of the group to
-  // exist, but create all that are missing - this used to exist in highfive
-    inline std::string getParentName(const std::string& path)
-    {
-        std::size_t idx = path.find_last_of("/");
-        if (idx == std::string::npos or idx == 0)
-            return "/";
-        return path.substr(0, idx);
-    }
-
-    inline void createGroupsToDataSet(HiFile& file, const std::string& path)
-    {
-        std::string group_name = getParentName(path);
-        if (!file.exist(group_name))
-            file.createGroup(group_name);
-    }
-} // namespace
-
-
-/*
- * Communicate all dataset paths and sizes to all MPI process to allow each to create all
- * datasets independently. This is a requirement of HDF5.
- * in the case of a disparate number of datasets per MPI process, dataSetSize may be 0
- * such that the current process creates datasets for all other processes with non-zero
- * sizes. Recommended to use similar sized paths, if possible.
- */
-
-namespace
-{
-    template<typename Size>
-    bool is_zero(Size size)
-    {
-        if constexpr (core::is_iterable_v<Size>)
-            return std::all_of(size.begin(), size.end(), [](auto const& val) { return val == 0; });
-
-        else
-            return size == 0;
-    }
-
-}
-
-template<typename ModelView>
-template<typename Type, typename Size>
-void Writer<ModelView>::createDatasetsPerMPI(HiFile& h5file, std::string path, Size dataSetSize)
-{
-    auto mpi_size = core::mpi::size();
-    auto sizes    = core::mpi::collect(dataSetSize, mpi_size);
-    auto paths    = core::mpi::collect(path, mpi_size);
-    for (int i = 0; i < mpi_size; i++)
-    {
-        if (is_zero(sizes[i]))
-            continue;
-        createGroupsToDataSet(h5file, paths[i]);
-        h5file.createDataSet<Type>(paths[i], HighFive::DataSpace(sizes[i]));
-    }
-}
-
-
-
 /*
- * Communicate all attribute paths and values to all MPI process to allow each to create all
- * attributes independently. This is a requirement of HDF5.
- * in the case of a disparate number of attributes per MPI process, path may be an empty string
- * such that the current process creates attributes for all other processes with non-zero
- * sizes. Recommended to use similar sized paths, if possible. key is always assumed to the be
- * the same
+ * Creates the files, the datasets and writes the attributes, everything but the data itself, so
+ * that with a background writer, data writes are the only file operations left once the data
+ * is staged.
  */
-template<typename ModelView>
-template<typename Data>
-void Writer<ModelView>::writeAttributesPerMPI(HiFile& h5file, std::string path, std::string key,
-                                              Data const& data)
-{
-    constexpr bool data_is_vector = core::is_std_vector_v<Data>;
-
-    auto doAttribute = [&](auto node, auto const& _key, auto const& value) {
-        if constexpr (data_is_vector)
-            node.template createAttribute<typename Data::value_type>(
-                    _key, HighFive::DataSpace(value.size()))
-                .write(value.data());
-        else
-            node.template createAttribute<Data>(_key, HighFive::DataSpace::From(value))
-                .write(value);
-    };
-
-    int mpi_size = core::mpi::size();
-    auto values  = [&]() {
-        if constexpr (data_is_vector)
-            return core::mpi::collect_raw(data, mpi_size);
-        else
-            return core::mpi::collect(data, mpi_size);
-    }();
-    auto paths = core::mpi::collect(path, mpi_size);
-
-    for (int i = 0; i < mpi_size; i++)
-    {
-        std::string const keyPath = paths[i] == "null" ? "" : paths[i];
-        if (keyPath.empty())
-            continue;
-
-        if (h5file.exist(keyPath) && h5file.getObjectType(keyPath) == HighFive::ObjectType::Dataset)
-        {
-            if (!h5file.getDataSet(keyPath).hasAttribute(key))
-                doAttribute(h5file.getDataSet(keyPath), key, values[i]);
-        }
-        else // group
-        {
-            createGroupsToDataSet(h5file, keyPath + "/dataset");
-            if (!h5file.getGroup(keyPath).hasAttribute(key))
-                doAttribute(h5file.getGroup(keyPath), key, values[i]);
-        }
-    }
-}
-
-
-
 template<typename ModelView>
 void Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*> const& diagnostics)
 {
     std::size_t maxLocalLevel = 0;
     std::unordered_map<std::size_t, std::vector<std::string>> lvlPatchIDs;
     Attributes patchAttributes; // stores dataset info/size for synced MPI creation
+    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>
+        patchProperties;
 
     for (auto* diag : diagnostics)
         writers.at(diag->type)->createFiles(*diag);
 
-    auto collectPatchAttributes = [&](GridLayout&, std::string patchID, std::size_t iLevel) {
+    manifest_.start("/t/" + core::to_string_with_precision(timestamp_, timestamp_precision));
+    if (levelLayout_)
+        levelLayout_->start();
+
+    auto collectPatchAttributes = [&](GridLayout& gridLayout, std::string patchID,
+                                      std::size_t iLevel) {
         if (!lvlPatchIDs.count(iLevel))
             lvlPatchIDs.emplace(iLevel, std::vector<std::string>());
+        if (!patchProperties.count(iLevel))
+            patchProperties.emplace(iLevel, std::vector<std::pair<std::string, Attributes>>{});
 
         lvlPatchIDs.at(iLevel).emplace_back(patchID);
+        patchProperties[iLevel].emplace_back(patchID, modelView_.getPatchProperties(gridLayout));
 
         for (auto* diag : diagnostics)
         {
@@ -398,16 +426,27 @@ void Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*> c
     modelView_.visitHierarchy(collectPatchAttributes, minLevel, maxLevel);
 
     // sets empty vectors in case current process lacks patch on a level
-    std::size_t maxMPILevel = core::mpi::max(maxLocalLevel);
-    for (std::size_t lvl = minLevel; lvl <= maxMPILevel; lvl++)
+    for (std::size_t lvl = minLevel; lvl <= maxLocalLevel; lvl++)
+    {
         if (!lvlPatchIDs.count(lvl))
             lvlPatchIDs.emplace(lvl, std::vector<std::string>());
+        if (!patchProperties.count(lvl))
+            patchProperties.emplace(lvl, std::vector<std::pair<std::string, Attributes>>{});
+    }
 
+    std::vector<HiFile*> files;
     for (auto* diagnostic : diagnostics)
     {
-        writers.at(diagnostic->type)
-            ->initDataSets(*diagnostic, lvlPatchIDs, patchAttributes, maxMPILevel);
+        auto& writer = *writers.at(diagnostic->type);
+        setDataSetOptions_(*diagnostic);
+        writer.initDataSets(*diagnostic, lvlPatchIDs, patchAttributes, maxLocalLevel);
+        writer.writeAttributes(*diagnostic, fileAttributes_, patchProperties, maxLocalLevel);
+        files.push_back(&writer.h5File(*diagnostic));
     }
+
+    if (levelLayout_)
+        levelLayout_->record();
+    manifest_.create(files);
 }
 
 
@@ -415,31 +454,72 @@ void Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*> c
 template<typename ModelView>
 void Writer<ModelView>::writeDatasets_(std::vector<DiagnosticProperties*> const& diagnostics)
 {
-    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>
-        patchAttributes;
-
-    std::size_t maxLocalLevel = 0;
-    auto writePatch = [&](GridLayout& gridLayout, std::string patchID, std::size_t iLevel) {
-        if (!patchAttributes.count(iLevel))
-            patchAttributes.emplace(iLevel, std::vector<std::pair<std::string, Attributes>>{});
-        patchPath_ = getPatchPathAddTimestamp(iLevel, patchID);
-        patchAttributes[iLevel].emplace_back(patchID, modelView_.getPatchProperties(gridLayout));
+    auto writePatch = [&](GridLayout&, std::string patchID, std::size_t iLevel) {
+        patchPath_  = getPatchPathAddTimestamp(iLevel, patchID);
+        patchLevel_ = iLevel;
         for (auto* diagnostic : diagnostics)
             writers.at(diagnostic->type)->write(*diagnostic);
-        maxLocalLevel = iLevel;
     };
 
     modelView_.visitHierarchy(writePatch, minLevel, maxLevel);
 
-    std::size_t maxMPILevel = core::mpi::max(maxLocalLevel);
-    // sets empty vectors in case current process lacks patch on a level
-    for (std::size_t lvl = minLevel; lvl <= maxMPILevel; lvl++)
-        if (!patchAttributes.count(lvl))
-            patchAttributes.emplace(lvl, std::vector<std::pair<std::string, Attributes>>{});
+    // the patch data staged by the level layout is written once per dataset
+    if (levelLayout_)
+        levelLayout_->write([&](std::function<void()> task) {
+            if (ioQueue_)
+                ioQueue_->push(std::move(task));
+            else
+                task();
+        });
+}
 
-    for (auto* diagnostic : diagnostics)
-        writers.at(diagnostic->type)
-            ->writeAttributes(*diagnostic, fileAttributes_, patchAttributes, maxMPILevel);
+
+
+/*
+ * Parallel HDF5 only applies filters to datasets written collectively, which the writer does
+ * not do: each process writes its own patches. Compression is therefore refused with more than
+ * one MPI process rather than silently dropped.
+ */
+template<typename ModelView>
+void Writer<ModelView>::setDataSetOptions_(DiagnosticProperties const& diagnostic)
+{
+    auto param = [&](std::string const& key) -> std::size_t {
+        return diagnostic.params.contains(key) ? diagnostic.param<std::size_t>(key) : 0;
+    };
+
+    dataSetOptions_.chunkRows = param("chunk_size");
+    dataSetOptions_.deflate   = static_cast<std::uint8_t>(param("compression"));
+    float32_                  = param("float32") > 0;
+
+#if defined(H5_HAVE_PARALLEL)
+    if (dataSetOptions_.deflate > 0 and core::mpi::size() > 1)
+        throw std::runtime_error("diagnostic " + diagnostic.type + " " + diagnostic.quantity
+                                 + ": compression is not supported with parallel HDF5 on more "
+                                   "than one MPI process");
+#endif
+}
+
+
+
+/*
+ * The background writer does HDF5 operations while the main thread communicates, and with
+ * parallel HDF5 these operations use MPI, which requires MPI_THREAD_MULTIPLE.
+ */
+template<typename ModelView>
+bool Writer<ModelView>::asyncIsSupported_()
+{
+#if defined(H5_HAVE_PARALLEL)
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE)
+    {
+        if (core::mpi::rank() == 0)
+            std::cout << "MPI_THREAD_MULTIPLE is not available, diagnostics are written "
+                         "synchronously\n";
+        return false;
+    }
+#endif
+    return true;
 }
 
 
@@ -103,39 +103,33 @@ void ElectromagDiagnosticWriter<H5Writer>::initDataSets(
     auto& h5file   = fileData_.at(diagnostic.quantity)->file();
     auto vecFields = h5Writer.modelView().getElectromagFields();
 
-    auto initVF = [&](auto& path, auto& attr, std::string key, auto null) {
+    auto initVF = [&](auto& path, auto& attr, std::string key) {
         for (auto& [id, type] : core::Components::componentMap)
         {
             auto vFPath = path + "/" + key + "_" + id;
             h5Writer.template createDataSet<FloatType>(
-                h5file, vFPath,
-                null ? std::vector<std::size_t>(GridLayout::dimension, 0)
-                     : attr[key][id].template to<std::vector<std::size_t>>());
+                h5file, vFPath, attr[key][id].template to<std::vector<std::size_t>>());
 
-            this->writeGhostsAttr_(
-                h5file, vFPath, null ? 0 : attr[key][id + "_ghosts_x"].template to<std::size_t>(),
-                null);
+            this->writeGhostsAttr_(h5file, vFPath,
+                                   attr[key][id + "_ghosts_x"].template to<std::size_t>());
 
             if constexpr (GridLayout::dimension > 1)
-                this->writeGhostsAttr_(
-                    h5file, vFPath,
-                    null ? 0 : attr[key][id + "_ghosts_y"].template to<std::size_t>(), null);
+                this->writeGhostsAttr_(h5file, vFPath,
+                                       attr[key][id + "_ghosts_y"].template to<std::size_t>());
 
             if constexpr (GridLayout::dimension > 2)
-                this->writeGhostsAttr_(
-                    h5file, vFPath,
-                    null ? 0 : attr[key][id + "_ghosts_z"].template to<std::size_t>(), null);
+                this->writeGhostsAttr_(h5file, vFPath,
+                                       attr[key][id + "_ghosts_z"].template to<std::size_t>());
         }
     };
 
-    auto initPatch = [&](auto& level, auto& attr, std::string patchID = "") {
-        bool null = patchID.empty();
+    auto initPatch = [&](auto& level, auto& attr, std::string const& patchID) {
         std::string path{h5Writer.getPatchPathAddTimestamp(level, patchID)};
         for (auto* vecField : vecFields)
         {
             auto& name = vecField->name();
             if (diagnostic.quantity == "/" + name)
-                initVF(path, attr, name, null);
+                initVF(path, attr, name);
         }
     };
 
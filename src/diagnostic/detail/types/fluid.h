@@ -132,32 +132,26 @@ void FluidDiagnosticWriter<H5Writer>::initDataSets(
 
     auto checkActive = [&](auto& tree, auto var) { return diagnostic.quantity == tree + var; };
 
-    auto writeGhosts = [&](auto& path, auto& attr, std::string key, auto null) {
-        this->writeGhostsAttr_(file, path,
-                               null ? 0 : attr[key + "_ghosts_x"].template to<std::size_t>(), null);
+    auto writeGhosts = [&](auto& path, auto& attr, std::string key) {
+        this->writeGhostsAttr_(file, path, attr[key + "_ghosts_x"].template to<std::size_t>());
         if constexpr (GridLayout::dimension > 1)
-            this->writeGhostsAttr_(
-                file, path, null ? 0 : attr[key + "_ghosts_y"].template to<std::size_t>(), null);
+            this->writeGhostsAttr_(file, path, attr[key + "_ghosts_y"].template to<std::size_t>());
         if constexpr (GridLayout::dimension > 2)
-            this->writeGhostsAttr_(
-                file, path, null ? 0 : attr[key + "_ghosts_z"].template to<std::size_t>(), null);
+            this->writeGhostsAttr_(file, path, attr[key + "_ghosts_z"].template to<std::size_t>());
     };
 
-    auto initDS = [&](auto& path, auto& attr, std::string key, auto null) {
+    auto initDS = [&](auto& path, auto& attr, std::string key) {
         auto dsPath = path + key;
         h5Writer.template createDataSet<FloatType>(
-            file, dsPath,
-            null ? std::vector<std::size_t>(GridLayout::dimension, 0)
-                 : attr[key].template to<std::vector<std::size_t>>());
-        writeGhosts(dsPath, attr, key, null);
+            file, dsPath, attr[key].template to<std::vector<std::size_t>>());
+        writeGhosts(dsPath, attr, key);
     };
-    auto initVF = [&](auto& path, auto& attr, std::string key, auto null) {
+    auto initVF = [&](auto& path, auto& attr, std::string key) {
         for (auto& [id, type] : core::Components::componentMap)
-            initDS(path, attr, key + "_" + id, null);
+            initDS(path, attr, key + "_" + id);
     };
 
-    auto initPatch = [&](auto& lvl, auto& attr, std::string patchID = "") {
-        bool null        = patchID.empty();
+    auto initPatch = [&](auto& lvl, auto& attr, std::string const& patchID) {
         std::string path = h5Writer.getPatchPathAddTimestamp(lvl, patchID) + "/";
 
         for (auto& pop : ions)
@@ -166,16 +160,16 @@ void FluidDiagnosticWriter<H5Writer>::initDataSets(
             std::string tree{"/ions/pop/" + pop.name() + "/"};
             std::string popPath(path + "pop/" + pop.name() + "/");
             if (checkActive(tree, "density"))
-                initDS(path, attr[popId], "density", null);
+                initDS(path, attr[popId], "density");
             if (checkActive(tree, "flux"))
-                initVF(path, attr[popId], "flux", null);
+                initVF(path, attr[popId], "flux");
         }
 
         std::string tree{"/ions/"};
         if (checkActive(tree, "density"))
-            initDS(path, attr["ion"], "density", null);
+            initDS(path, attr["ion"], "density");
         if (checkActive(tree, "bulkVelocity"))
-            initVF(path, attr["ion"], "bulkVelocity", null);
+            initVF(path, attr["ion"], "bulkVelocity");
     };
 
     initDataSets_(patchIDs, patchAttributes, maxLevel, initPatch);
@@ -191,7 +185,8 @@ void FluidDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic)
 
     auto checkActive = [&](auto& tree, auto var) { return diagnostic.quantity == tree + var; };
     auto writeDS     = [&](auto path, auto& field) {
-        hfile.template write_data_set_flat<GridLayout::dimension>(path, &(*field.begin()));
+        h5Writer.template writeDataSet<GridLayout::dimension>(hfile, path, &(*field.begin()),
+                                                              field.size());
     };
     auto writeVF
         = [&](auto path, auto& vecF) { h5Writer.writeVecFieldAsDataset(hfile, path, vecF); };
@@ -6,11 +6,14 @@
 
 #include "core/data/particles/particle_packer.h"
 
+#include "amr/amr_constants.h"
 #include "amr/data/particles/particles_data.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace PHARE::diagnostic::h5
 {
@@ -61,6 +64,59 @@ public:
         DiagnosticProperties&, Attributes&,
         std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
         std::size_t maxLevel) override;
+
+private:
+    // particles that are not written straight from their storage are copied by chunks
+    static constexpr std::size_t chunk_size = 1 << 16;
+
+    /* the particles written by a diagnostic: every "subsample"th particle of those in the cells
+     * of "select_box", given as the lower then upper cells of a box of level 0
+     */
+    struct Selection
+    {
+        std::size_t subsample = 1;
+        std::vector<int> box; // on the level of the particles, empty for all cells
+
+        bool all() const { return subsample == 1 and box.empty(); }
+
+        // calls fn with the index of each selected particle
+        template<typename Particles, typename Fn>
+        void visit(Particles const& particles, Fn&& fn) const
+        {
+            std::size_t inBox = 0;
+            for (std::size_t i = 0; i < particles.size(); ++i)
+                if (isIn_(particles[i]) and inBox++ % subsample == 0)
+                    fn(i);
+        }
+
+        template<typename Particles>
+        std::size_t count(Particles const& particles) const
+        {
+            if (all())
+                return particles.size();
+            std::size_t n = 0;
+            visit(particles, [&](auto) { ++n; });
+            return n;
+        }
+
+    private:
+        template<typename Particle>
+        bool isIn_(Particle const& particle) const
+        {
+            if (box.empty())
+                return true;
+            for (std::size_t i = 0; i < dimension; ++i)
+                if (particle.iCell[i] < box[i] or particle.iCell[i] > box[dimension + i])
+                    return false;
+            return true;
+        }
+    };
+
+    static Selection selection_(DiagnosticProperties const& diagnostic, std::size_t iLevel);
+
+    template<typename Particles>
+    void writeParticles_(HighFiveFile& h5file, std::string const& path,
+                         Particles const& particles, Selection const& selection);
 };
 
 
@@ -85,18 +141,19 @@ void ParticlesDiagnosticWriter<H5Writer>::getDataSetInfo(DiagnosticProperties& d
 
     auto getSize = [&](auto const& value, auto n_particles) {
         using ValueType = std::decay_t<decltype(value)>;
-        if (n_particles == 0)
-            return std::vector<std::size_t>{0};
         if constexpr (is_array_dataset<ValueType, dimension>)
             return std::vector<std::size_t>{n_particles, value.size()};
         else /* not an array so value one of type ValueType*/
             return std::vector<std::size_t>{n_particles, 1};
     };
 
+    auto const selection = selection_(diagnostic, iLevel);
+
     auto particleInfo = [&](auto& attr, auto& particles) {
-        std::size_t part_idx = 0;
+        auto const n_particles = selection.count(particles);
+        std::size_t part_idx   = 0;
         core::apply(Packer::empty(), [&](auto const& arg) {
-            attr[Packer::keys()[part_idx]] = getSize(arg, particles.size());
+            attr[Packer::keys()[part_idx]] = getSize(arg, n_particles);
             ++part_idx;
         });
     };
@@ -127,39 +184,37 @@ void ParticlesDiagnosticWriter<H5Writer>::initDataSets(
     auto& h5Writer = this->h5Writer_;
     auto& h5file   = fileData_.at(diagnostic.quantity)->file();
 
-    auto createDataSet = [&](auto&& path, auto& attr, auto& key, auto& value, auto null) {
+    auto createDataSet = [&](auto&& path, auto& attr, auto& key, auto& value) {
         using ValueType = std::decay_t<decltype(value)>;
 
-        auto shape = null ? std::vector<std::size_t>(0)
-                          : attr[key].template to<std::vector<std::size_t>>();
+        auto shape = attr[key].template to<std::vector<std::size_t>>();
 
         if constexpr (is_array_dataset<ValueType, dimension>)
         {
-            return h5Writer.template createDataSet<typename ValueType::value_type>(h5file, path,
-                                                                                   shape);
+            // only velocities may be stored as float32, positions and weights are kept as is
+            return h5Writer.template createDataSet<typename ValueType::value_type>(
+                h5file, path, shape, std::string{key} == "v");
         }
         else
-            return h5Writer.template createDataSet<ValueType>(h5file, path, shape);
+            return h5Writer.template createDataSet<ValueType>(h5file, path, shape, false);
     };
 
     auto initDataSet = [&](auto& lvl, auto& patchID, auto& attr) {
-        bool null = patchID.empty();
         std::string path{h5Writer_.getPatchPathAddTimestamp(lvl, patchID) + "/"};
         std::size_t part_idx = 0;
         core::apply(Packer::empty(), [&](auto const& arg) {
-            createDataSet(path + Packer::keys()[part_idx], attr, Packer::keys()[part_idx], arg,
-                          null);
+            createDataSet(path + Packer::keys()[part_idx], attr, Packer::keys()[part_idx], arg);
             ++part_idx;
         });
-        this->writeGhostsAttr_(h5file, path, amr::ghostWidthForParticles<interpOrder>(), null);
+        this->writeGhostsAttr_(h5file, path, amr::ghostWidthForParticles<interpOrder>());
     };
 
     auto initIfActive = [&](auto& lvl, auto& tree, auto& attr, auto& pop, auto& patch, auto var) {
         if (diagnostic.quantity == tree + var)
-            initDataSet(lvl, patch, patch.empty() ? attr : attr[pop][var]);
+            initDataSet(lvl, patch, attr[pop][var]);
     };
 
-    auto initPatch = [&](auto& lvl, auto& attr, std::string patchID = "") {
+    auto initPatch = [&](auto& lvl, auto& attr, std::string const& patchID) {
         for (auto& pop : h5Writer.modelView().getIons())
         {
             std::string tree{"/ions/pop/" + pop.name() + "/"};
@@ -176,29 +231,14 @@ void ParticlesDiagnosticWriter<H5Writer>::initDataSets(
 template<typename H5Writer>
 void ParticlesDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic)
 {
-    auto& h5Writer = this->h5Writer_;
-
-    auto writeParticles = [&](auto path, auto& particles) {
-        if (particles.size() == 0)
-            return;
-
-        auto& h5file = *fileData_.at(diagnostic.quantity);
-        Packer packer(particles);
-        core::ContiguousParticles<dimension> copy{particles.size()};
-        packer.pack(copy);
-
-
-        h5file.template write_data_set_flat<2>(path + packer.keys()[0], copy.weight.data());
-        h5file.template write_data_set_flat<2>(path + packer.keys()[1], copy.charge.data());
-        h5file.template write_data_set_flat<2>(path + packer.keys()[2], copy.iCell.data());
-        h5file.template write_data_set_flat<2>(path + packer.keys()[3], copy.delta.data());
-        h5file.template write_data_set_flat<2>(path + packer.keys()[4], copy.v.data());
-    };
+    auto& h5Writer       = this->h5Writer_;
+    auto const selection = selection_(diagnostic, h5Writer.patchLevel());
 
     auto checkWrite = [&](auto& tree, auto pType, auto& ps) {
         std::string active{tree + pType};
         if (diagnostic.quantity == active)
-            writeParticles(h5Writer.patchPath() + "/", ps);
+            writeParticles_(*fileData_.at(diagnostic.quantity), h5Writer.patchPath() + "/", ps,
+                            selection);
     };
 
     for (auto& pop : h5Writer.modelView().getIons())
@@ -211,6 +251,107 @@ void ParticlesDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic
 }
 
 
+template<typename H5Writer>
+template<typename Particles>
+void ParticlesDiagnosticWriter<H5Writer>::writeParticles_(HighFiveFile& h5file,
+                                                          std::string const& path,
+                                                          Particles const& particles,
+                                                          Selection const& selection)
+{
+    auto& h5Writer = this->h5Writer_;
+    auto& keys     = Packer::keys();
+
+    if (particles.size() == 0)
+        return;
+
+    // structures of arrays are written from their storage, only copied if written in background
+    if constexpr (Particles::is_contiguous)
+        if (selection.all())
+        {
+            auto write = [&](auto const& key, auto const& array) {
+                h5Writer.template writeDataSet<2>(h5file, path + key, array.data(), array.size());
+            };
+            write(keys[0], particles.weight);
+            write(keys[1], particles.charge);
+            write(keys[2], particles.iCell);
+            write(keys[3], particles.delta);
+            write(keys[4], particles.v);
+            return;
+        }
+
+    // otherwise, selected particles are copied by chunks, to buffers reused if written
+    // synchronously
+    std::vector<double> weight, charge, delta, v;
+    std::vector<int> iCell;
+    std::size_t firstRow = 0;
+
+    auto reserve = [&]() {
+        weight.reserve(chunk_size);
+        charge.reserve(chunk_size);
+        iCell.reserve(chunk_size * dimension);
+        delta.reserve(chunk_size * dimension);
+        v.reserve(chunk_size * 3);
+    };
+
+    auto writeChunk = [&]() {
+        auto const rows = weight.size();
+        if (rows == 0)
+            return;
+
+        h5Writer.writeDataSetRows(h5file, path + keys[0], firstRow, 1, std::move(weight));
+        h5Writer.writeDataSetRows(h5file, path + keys[1], firstRow, 1, std::move(charge));
+        h5Writer.writeDataSetRows(h5file, path + keys[2], firstRow, dimension, std::move(iCell));
+        h5Writer.writeDataSetRows(h5file, path + keys[3], firstRow, dimension, std::move(delta));
+        h5Writer.writeDataSetRows(h5file, path + keys[4], firstRow, 3, std::move(v));
+        firstRow += rows;
+
+        for (auto* buffer : {&weight, &charge, &delta, &v})
+            buffer->clear();
+        iCell.clear();
+        reserve();
+    };
+
+    reserve();
+    selection.visit(particles, [&](std::size_t i) {
+        auto const& particle = particles[i];
+        weight.push_back(particle.weight);
+        charge.push_back(particle.charge);
+        iCell.insert(iCell.end(), particle.iCell.begin(), particle.iCell.end());
+        delta.insert(delta.end(), particle.delta.begin(), particle.delta.end());
+        v.insert(v.end(), particle.v.begin(), particle.v.end());
+
+        if (weight.size() == chunk_size)
+            writeChunk();
+    });
+    writeChunk();
+}
+
+
+template<typename H5Writer>
+auto ParticlesDiagnosticWriter<H5Writer>::selection_(DiagnosticProperties const& diagnostic,
+                                                     std::size_t iLevel) -> Selection
+{
+    Selection selection;
+    if (diagnostic.params.contains("subsample"))
+        selection.subsample = std::max<std::size_t>(1, diagnostic.param<std::size_t>("subsample"));
+
+    if (diagnostic.params.contains("select_box"))
+    {
+        int ratio = 1;
+        for (std::size_t i = 0; i < iLevel; ++i)
+            ratio *= static_cast<int>(amr::refinementRatio);
+
+        selection.box = diagnostic.param<std::vector<int>>("select_box");
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            selection.box[i] *= ratio;
+            selection.box[dimension + i] = (selection.box[dimension + i] + 1) * ratio - 1;
+        }
+    }
+    return selection;
+}
+
+
 template<typename H5Writer>
 void ParticlesDiagnosticWriter<H5Writer>::writeAttributes(
     DiagnosticProperties& diagnostic, Attributes& fileAttributes,
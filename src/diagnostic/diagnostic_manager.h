@@ -45,6 +45,7 @@ class IDiagnosticsManager
 public:
     virtual bool dump(double timeStamp, double timeStep)         = 0;
     virtual void dump_level(std::size_t level, double timeStamp) = 0;
+    virtual void wait()                                          = 0; // for async writes
     inline virtual ~IDiagnosticsManager();
 };
 IDiagnosticsManager::~IDiagnosticsManager() {}
@@ -61,6 +62,9 @@ public:
     void dump_level(std::size_t level, double timeStamp) override;
 
 
+    void wait() override { writer_->wait(); }
+
+
     DiagnosticsManager(std::unique_ptr<Writer>&& writer_ptr)
         : writer_{std::move(writer_ptr)}
     {
@@ -140,6 +144,12 @@ DiagnosticsManager<Writer>::addDiagDict(initializer::PHAREDict const& diagParams
     diagProps.writeTimestamps = diagParams["write_timestamps"].template to<std::vector<double>>();
     diagProps["flush_every"]  = diagParams["flush_every"].template to<std::size_t>();
 
+    for (std::string const key : {"chunk_size", "compression", "float32", "subsample"})
+        if (diagParams.contains(key))
+            diagProps[key] = diagParams[key].template to<std::size_t>();
+    if (diagParams.contains("select_box"))
+        diagProps["select_box"] = diagParams["select_box"].template to<std::vector<int>>();
+
     diagProps.computeTimestamps
         = diagParams["compute_timestamps"].template to<std::vector<double>>();
 
@@ -80,18 +80,6 @@ public:
     }
 
 
-    static auto getEmptyPatchProperties()
-    {
-        PatchProperties dict;
-        dict["origin"]   = std::vector<double>{};
-        dict["nbrCells"] = std::vector<std::uint32_t>{};
-        dict["lower"]    = std::vector<int>{};
-        dict["upper"]    = std::vector<int>{};
-        dict["mpi_rank"] = std::size_t{0};
-        return dict;
-    }
-
-
 protected:
     Model& model_;
     Hierarchy& hierarchy_;
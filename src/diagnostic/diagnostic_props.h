@@ -12,7 +12,7 @@ namespace PHARE::diagnostic
 struct DiagnosticProperties
 {
     // Types limited to actual need, no harm to modify
-    using Params         = cppdict::Dict<std::size_t>;
+    using Params         = cppdict::Dict<std::size_t, std::vector<int>>;
     using FileAttributes = cppdict::Dict<std::string>;
 
     std::vector<double> writeTimestamps, computeTimestamps;
@@ -47,6 +47,8 @@ struct NullOpDiagnosticsManager : public IDiagnosticsManager
     {
         throw std::runtime_error("NOOP");
     }
+
+    void wait() override {}
 };
 
 struct DiagnosticsManagerResolver
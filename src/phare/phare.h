@@ -29,7 +29,16 @@ class SamraiLifeCycle
 public:
     SamraiLifeCycle(int argc = 0, char** argv = nullptr)
     {
-        SAMRAI::tbox::SAMRAI_MPI::init(&argc, &argv);
+        // asynchronous diagnostics use MPI, through parallel HDF5, from a background thread
+        int initialized = 0;
+        MPI_Initialized(&initialized);
+        if (!initialized)
+        {
+            int provided = MPI_THREAD_SINGLE;
+            MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+            startedMPI_ = true;
+        }
+        SAMRAI::tbox::SAMRAI_MPI::init(MPI_COMM_WORLD);
         SAMRAI::tbox::SAMRAIManager::initialize();
         SAMRAI::tbox::SAMRAIManager::startup();
 
@@ -42,6 +51,8 @@ public:
         SAMRAI::tbox::SAMRAIManager::shutdown();
         SAMRAI::tbox::SAMRAIManager::finalize();
         SAMRAI::tbox::SAMRAI_MPI::finalize();
+        if (startedMPI_)
+            MPI_Finalize();
     }
 
     static void reset()
@@ -50,6 +61,9 @@ public:
         SAMRAI::tbox::SAMRAIManager::shutdown();
         SAMRAI::tbox::SAMRAIManager::startup();
     }
+
+private:
+    bool startedMPI_ = false;
 };
 
 
@@ -26,6 +26,10 @@
 
 #include "cppdict/include/dict.hpp"
 
+#if !defined(PHARE_PARTICLES_SOA)
+#define PHARE_PARTICLES_SOA false
+#endif
+
 namespace PHARE::core
 {
 template<std::size_t dimension_, std::size_t interp_order_>
@@ -43,8 +47,9 @@ struct PHARE_Types
 
     using Particle_t      = PHARE::core::Particle<dimension>;
     using ParticleAoS_t   = PHARE::core::ParticleArray<dimension>;
-    using ParticleArray_t = ParticleAoS_t;
     using ParticleSoA_t   = PHARE::core::ContiguousParticles<dimension>;
+    using ParticleArray_t // compile with -DPHARE_PARTICLES_SOA=1 for structure of arrays
+        = std::conditional_t<PHARE_PARTICLES_SOA, ParticleSoA_t, ParticleAoS_t>;
 
 
     using MaxwellianParticleInitializer_t
@@ -270,7 +270,7 @@ public:
 
             auto& patch_data = inner[key].emplace_back(particles.size());
             setPatchDataFromGrid(patch_data, grid, patchID);
-            core::ParticlePacker<dimension>{particles}.pack(patch_data.data);
+            core::ParticlePacker{particles}.pack(patch_data.data);
         };
 
         auto& ions = model_.state.ions;
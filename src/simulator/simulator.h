@@ -11,9 +11,12 @@
 #include "core/utilities/mpi_utils.h"
 #include "core/utilities/timestamps.h"
 #include "amr/tagging/tagger_factory.h"
+#include "amr/load_balancing/hybrid_load_balancer_estimator.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
+#include <numeric>
 
 
 namespace PHARE
@@ -43,7 +46,7 @@ template<std::size_t _dimension, std::size_t _interp_order, std::size_t _nbRefin
 class Simulator : public ISimulator
 {
 public:
-    double startTime() override { return 0.; }
+    double startTime() override { return startTime_; }
     double endTime() override { return finalTime_; }
     double timeStep() override { return dt_; }
     double currentTime() override { return currentTime_; }
@@ -59,6 +62,8 @@ public:
     auto& getMHDModel() { return mhdModel_; }
     auto& getMultiPhysicsIntegrator() { return multiphysInteg_; }
 
+    void rebalanceCoarsestLevel();
+
     std::string to_str() override;
 
     bool dump(double timestamp, double timestep) override
@@ -96,6 +101,11 @@ public:
 private:
     auto find_model(std::string name);
 
+    void rebalance_();
+
+    bool restartIsDue_();
+    void writeRestart_();
+
     std::ofstream log_out{".log/" + std::to_string(core::mpi::rank()) + ".out"};
     std::streambuf* coutbuf;
     std::shared_ptr<PHARE::amr::Hierarchy> hierarchy_;
@@ -111,10 +121,25 @@ private:
     double dt_;
     int timeStepNbr_           = 0;
     double finalTime_          = 0;
+    double startTime_          = 0;
     double currentTime_        = 0;
     bool isInitialized         = false;
     std::size_t fineDumpLvlMax = 0;
 
+    // every rebalanceInterval_ steps (never if 0), the coarsest level is rebalanced if the
+    // largest rank work time exceeds rebalanceThreshold_ times the average one
+    std::size_t rebalanceInterval_   = 0;
+    double rebalanceThreshold_       = 0;
+    std::size_t stepsSinceRebalance_ = 0;
+
+    // restart files are written to restartDir_ every restartInterval_ steps and/or every
+    // restartSeconds_ of wall time, 0 meaning never
+    std::shared_ptr<amr::RestartState> restartState_;
+    std::string restartDir_;
+    std::size_t restartInterval_ = 0;
+    double restartSeconds_       = 0;
+    std::chrono::steady_clock::time_point lastRestart_;
+
     // physical models that can be used
     std::shared_ptr<HybridModel> hybridModel_;
     std::shared_ptr<MHDModel> mhdModel_;
@@ -176,6 +201,15 @@ Simulator<_dimension, _interp_order, _nbRefinedPart>::Simulator(
 
         hybridModel_->resourcesManager->registerResources(hybridModel_->state);
 
+        // the model state is all a simulation needs to resume from restart files
+        if (dict["simulation"].contains("restarts"))
+        {
+            restartState_ = std::make_shared<amr::RestartState>(
+                dict["simulation"], hierarchy_,
+                hybridModel_->resourcesManager->getIDs(hybridModel_->state));
+            multiphysInteg_->registerRestartState(restartState_);
+        }
+
         // we register the hybrid model for all possible levels in the hierarchy
         // since for now it is the only model available
         // same for the solver
@@ -191,15 +225,55 @@ Simulator<_dimension, _interp_order, _nbRefinedPart>::Simulator(
         multiphysInteg_->registerTagger(0, maxLevelNumber_ - 1, std::move(hybridTagger_));
 
 
-        auto startTime = 0.; // TODO make it runtime
+        auto startTime = restartState_ ? restartState_->restartTime() : 0.;
         auto endTime   = 0.; // TODO make it runtime
 
+        // the TimeRefinementIntegrator reads back the steps done if SAMRAI reads its state
+        auto startStep = 0;
+        if (restartState_ and !restartState_->restoresHierarchy())
+            startStep = restartState_->restartStep();
+
+
+        // by default, SAMRAI balances the number of cells of the patches
+        int workloadDataId = -1;
+        auto& amrDict      = dict["simulation"]["AMR"];
+        if (amrDict.contains("load_balancing")
+            and amrDict["load_balancing"]["mode"].template to<std::string>() == "particles")
+        {
+            auto fieldWeight = amrDict["load_balancing"]["field_weight"].template to<double>();
+            auto estimator
+                = std::make_unique<amr::HybridLoadBalancerEstimator<HybridModel>>(fieldWeight);
+            workloadDataId = estimator->workloadId();
+            multiphysInteg_->registerLoadBalancerEstimator(std::move(estimator));
+        }
+
+        if (amrDict.contains("load_balancing")
+            and amrDict["load_balancing"].contains("rebalance_interval"))
+        {
+            auto& lbDict        = amrDict["load_balancing"];
+            rebalanceInterval_  = lbDict["rebalance_interval"].template to<std::size_t>();
+            rebalanceThreshold_ = lbDict["rebalance_threshold"].template to<double>();
+        }
 
         integrator_ = std::make_unique<Integrator>(dict, hierarchy, multiphysInteg_,
-                                                   multiphysInteg_, startTime, endTime);
+                                                   multiphysInteg_, startTime, endTime,
+                                                   workloadDataId, startStep);
+
 
+        if (dict["simulation"].contains("restarts"))
+        {
+            auto& restarts   = dict["simulation"]["restarts"];
+            restartDir_      = restarts["dir"].template to<std::string>();
+            restartInterval_ = restarts["interval"].template to<std::size_t>();
+            restartSeconds_  = restarts["seconds"].template to<double>();
+            lastRestart_     = std::chrono::steady_clock::now();
+        }
 
-        timeStamper = core::TimeStamperFactory::create(dict["simulation"]);
+        // when restarting, the integrator starts at the time the restart files were written
+        startTime_   = integrator_->currentTime();
+        currentTime_ = startTime_;
+        timeStamper  = core::TimeStamperFactory::create(dict["simulation"],
+                                                       integrator_->currentStep());
 
         if (dict["simulation"].contains("diagnostics"))
         {
@@ -261,6 +335,10 @@ void Simulator<_dimension, _interp_order, _nbRefinedPart>::initialize()
             integrator_->initialize();
         else
             throw std::runtime_error("Error - Simulator has no integrator");
+
+        // all restarted data have been read, see Hierarchy::make()
+        if (restartState_)
+            restartState_->close();
     }
     catch (const std::runtime_error& e)
     {
@@ -298,6 +376,12 @@ double Simulator<_dimension, _interp_order, _nbRefinedPart>::advance(double dt)
         PHARE_LOG_SCOPE("Simulator::advance");
         dt_new       = integrator_->advance(dt);
         currentTime_ = ((*timeStamper) += dt);
+
+        if (rebalanceInterval_ > 0 and ++stepsSinceRebalance_ == rebalanceInterval_)
+            rebalance_();
+
+        if (restartIsDue_())
+            writeRestart_();
     }
     catch (std::runtime_error const& e)
     {
@@ -330,6 +414,81 @@ auto Simulator<_dimension, _interp_order, _nbRefinedPart>::find_model(std::strin
 
 
 
+template<std::size_t _dimension, std::size_t _interp_order, std::size_t _nbRefinedPart>
+void Simulator<_dimension, _interp_order, _nbRefinedPart>::rebalance_()
+{
+    PHARE_LOG_SCOPE("Simulator::rebalance_");
+
+    auto const workTimes = core::mpi::collect(multiphysInteg_->workTime());
+    multiphysInteg_->resetWorkTime();
+    stepsSinceRebalance_ = 0;
+
+    auto const maxTime  = *std::max_element(std::begin(workTimes), std::end(workTimes));
+    auto const meanTime = std::accumulate(std::begin(workTimes), std::end(workTimes), 0.)
+                          / workTimes.size();
+
+    // all ranks take the same decision since they all have the same work times
+    if (meanTime > 0 and maxTime / meanTime > rebalanceThreshold_)
+    {
+        std::cout << "rebalancing coarsest level, imbalance = " << maxTime / meanTime << "\n";
+        rebalanceCoarsestLevel();
+    }
+}
+
+
+
+/** redistributes the patches of the coarsest level among ranks, finer levels are kept as they
+ * are but the schedules they communicate with the coarsest level through are made again
+ */
+template<std::size_t _dimension, std::size_t _interp_order, std::size_t _nbRefinedPart>
+void Simulator<_dimension, _interp_order, _nbRefinedPart>::rebalanceCoarsestLevel()
+{
+    multiphysInteg_->estimateWorkload(hierarchy_, 0);
+    integrator_->rebalanceCoarsestLevel(currentTime_);
+    multiphysInteg_->registerFinerLevels(hierarchy_);
+}
+
+
+
+template<std::size_t _dimension, std::size_t _interp_order, std::size_t _nbRefinedPart>
+bool Simulator<_dimension, _interp_order, _nbRefinedPart>::restartIsDue_()
+{
+    auto const step = static_cast<std::size_t>(integrator_->currentStep());
+    if (restartInterval_ > 0 and step % restartInterval_ == 0)
+        return true;
+
+    if (restartSeconds_ > 0)
+    {
+        auto const elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                                           - lastRestart_)
+                                 .count();
+        // all ranks must write, even those whose clock is slightly behind
+        return core::mpi::any(elapsed >= restartSeconds_);
+    }
+
+    return false;
+}
+
+
+
+/** writes the hierarchy, the state of the model and of the time integrators with the SAMRAI
+ * RestartManager, in restartDir_/restore.<step>, with one file per rank
+ */
+template<std::size_t _dimension, std::size_t _interp_order, std::size_t _nbRefinedPart>
+void Simulator<_dimension, _interp_order, _nbRefinedPart>::writeRestart_()
+{
+    PHARE_LOG_SCOPE("Simulator::writeRestart_");
+
+    // restart files are HDF5 files too, and HDF5 is not used by two threads at once
+    if (dMan)
+        dMan->wait();
+
+    restartState_->write(restartDir_, integrator_->currentStep());
+    lastRestart_ = std::chrono::steady_clock::now();
+}
+
+
+
 struct SimulatorMaker
 {
     SimulatorMaker(std::shared_ptr<PHARE::amr::Hierarchy>& hierarchy)
@@ -1,5 +1,7 @@
 #include "test_copy_overlap_centered_ey.h"
 
+#include "amr/data/field/field_variable_fill_pattern.h"
+
 
 using namespace PHARE;
 
@@ -68,9 +70,75 @@ TYPED_TEST_P(AFieldData1DCenteredOnEy, CopyOnARegionWithPeriodicsLikeANodeData)
 
 
 
+TYPED_TEST_P(AFieldData1DCenteredOnEy, SumAddsSourceValuesWhereACopyWouldOverwrite)
+{
+    auto& param            = this->param;
+    auto& destinationField = param.destinationFieldData->field;
+    auto const& layout     = param.destinationFieldData->gridLayout;
+
+    auto iStart = layout.ghostStartIndex(destinationField, Direction::X);
+    auto iEnd   = layout.ghostEndIndex(destinationField, Direction::X);
+
+    SAMRAI::hier::IntVector shift{param.destinationPatch.getBox().lower()
+                                  - param.sourcePatch.getBox().upper()};
+    SAMRAI::hier::Transformation transformation{shift};
+
+    SAMRAI::hier::Box srcMask{this->sourceNodeData->getBox()};
+    SAMRAI::hier::Box fillMask{this->destinationNodeData->getGhostBox()};
+
+    auto overlap = param.destinationFieldGeometry->calculateOverlap(
+        *param.sourceFieldGeometry, srcMask, fillMask, true, transformation);
+
+    // copying on a zero destination gives the source values on the overlap and zero elsewhere
+    for (auto ix = iStart; ix <= iEnd; ++ix)
+        destinationField(ix) = 0.;
+    param.destinationFieldData->copy(*param.sourceFieldData, *overlap);
+
+    std::vector<double> copied;
+    for (auto ix = iStart; ix <= iEnd; ++ix)
+        copied.push_back(destinationField(ix));
+
+    param.resetValues();
+    param.destinationFieldData->sum(*param.sourceFieldData, *overlap);
+
+    for (auto ix = iStart; ix <= iEnd; ++ix)
+    {
+        EXPECT_DOUBLE_EQ(param.destinationFill(ix) + copied[ix - iStart], destinationField(ix));
+    }
+}
+
+
+
+
+TYPED_TEST_P(AFieldData1DCenteredOnEy, BorderSumFillPatternSkipsThePatchItself)
+{
+    auto& param = this->param;
+
+    FieldBorderSumFillPattern pattern;
+
+    auto const& dstGeometry = *param.destinationFieldGeometry;
+    auto const& dstBox      = param.destinationPatch.getBox();
+    auto const zero         = SAMRAI::hier::IntVector::getZero(this->dim);
+
+    SAMRAI::hier::Transformation noShift{zero};
+    auto itself = std::dynamic_pointer_cast<FieldOverlap>(
+        pattern.calculateOverlap(dstGeometry, dstGeometry, dstBox, dstBox, dstBox, true, noShift));
+    EXPECT_TRUE(itself->isOverlapEmpty());
+
+    // the periodic image of the patch shares its border nodes with it
+    SAMRAI::hier::Transformation periodicShift{SAMRAI::hier::IntVector{dstBox.numberCells()}};
+    auto image = std::dynamic_pointer_cast<FieldOverlap>(pattern.calculateOverlap(
+        dstGeometry, dstGeometry, dstBox, dstBox, dstBox, true, periodicShift));
+    EXPECT_FALSE(image->isOverlapEmpty());
+}
+
+
+
 REGISTER_TYPED_TEST_SUITE_P(AFieldData1DCenteredOnEy, CopyWithOverlapLikeANodeData,
                             CopyWithPeriodicsLikeANodeData,
-                            CopyOnARegionWithPeriodicsLikeANodeData);
+                            CopyOnARegionWithPeriodicsLikeANodeData,
+                            SumAddsSourceValuesWhereACopyWouldOverwrite,
+                            BorderSumFillPatternSkipsThePatchItself);
 
 
 INSTANTIATE_TYPED_TEST_SUITE_P(TestWithOrderFrom1To3That, AFieldData1DCenteredOnEy,
@@ -8,6 +8,7 @@
 #include "test_integrator_strat.h"
 #include "test_messenger_tag_strategy.h"
 #include "tests/initializer/init_functions.h"
+#include "core/numerics/moments/moments.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -174,6 +175,10 @@ PHARE::initializer::PHAREDict createDict()
     dict["ions"]["pop0"]["particle_initializer"]["charge"]            = -1.;
     dict["ions"]["pop0"]["particle_initializer"]["basis"]             = std::string{"cartesian"};
 
+    // seeded, so that hierarchies built from this dict load the same particles
+    dict["ions"]["pop0"]["particle_initializer"]["init"]["seed"]
+        = std::optional<std::size_t>{1337};
+
     dict["ions"]["pop1"]["name"]                         = std::string{"alpha"};
     dict["ions"]["pop1"]["mass"]                         = 1.;
     dict["ions"]["pop1"]["particle_initializer"]["name"] = std::string{"maxwellian"};
@@ -182,6 +187,9 @@ PHARE::initializer::PHAREDict createDict()
     dict["ions"]["pop1"]["particle_initializer"]["charge"]            = -1.;
     dict["ions"]["pop1"]["particle_initializer"]["basis"]             = std::string{"cartesian"};
 
+    dict["ions"]["pop1"]["particle_initializer"]["init"]["seed"]
+        = std::optional<std::size_t>{2334};
+
     dict["electromag"]["name"]             = std::string{"EM"};
     dict["electromag"]["electric"]["name"] = std::string{"E"};
     dict["electromag"]["magnetic"]["name"] = std::string{"B"};
@@ -443,11 +451,9 @@ TEST_F(HybridHybridMessenger, initializesNewFinestLevelAfterRegrid)
 }
 #endif
 
-template<uint8_t dimension, std::size_t nbRefinePart>
+template<uint8_t dimension, std::size_t nbRefinePart, std::size_t interpOrder = 1>
 struct AfullHybridBasicHierarchy
 {
-    static constexpr std::size_t interpOrder = 1;
-
     using Simulator         = typename PHARE::Simulator<dimension, interpOrder, nbRefinePart>;
     using HybridModelT      = typename Simulator::HybridModel;
     using MHDModelT         = typename Simulator::MHDModel;
@@ -471,8 +477,7 @@ struct AfullHybridBasicHierarchy
         std::make_shared<HybridModelT>(dict, resourcesManagerHybrid)};
 
 
-    std::unique_ptr<HybridMessengerStrategy<HybridModelT>> hybhybStrat{
-        std::make_unique<HybridHybridT>(resourcesManagerHybrid, firstHybLevel)};
+    std::unique_ptr<HybridMessengerStrategy<HybridModelT>> hybhybStrat;
 
     std::shared_ptr<HybridMessenger<HybridModelT>> messenger{
         std::make_shared<HybridMessenger<HybridModelT>>(std::move(hybhybStrat))};
@@ -490,7 +495,9 @@ struct AfullHybridBasicHierarchy
 
     std::shared_ptr<BasicHierarchy> basicHierarchy;
 
-    AfullHybridBasicHierarchy()
+    explicit AfullHybridBasicHierarchy(bool const sumBorderMoments = false)
+        : hybhybStrat{std::make_unique<HybridHybridT>(resourcesManagerHybrid, firstHybLevel,
+                                                      sumBorderMoments)}
     {
         hybridModel->resourcesManager->registerResources(hybridModel->state);
 
@@ -508,6 +515,318 @@ struct AfullHybridBasicHierarchy
 
 
 
+// ----------------------------------------------------------------------------
+// The tests below check that summing, on the nodes patches share, the moments each patch
+// deposited from its own particles gives the moments completed with patch ghost particles,
+// which are then only exchanged within a cell of the patches
+// ----------------------------------------------------------------------------
+
+
+template<typename InterpConst>
+struct HybridHybridMomentGhosts : public ::testing::Test
+{
+    static constexpr std::size_t dim         = 1;
+    static constexpr std::size_t interpOrder = InterpConst::value;
+
+    using Hierarchy   = AfullHybridBasicHierarchy<dim, 2, interpOrder>;
+    using GridLayoutT = typename Hierarchy::HybridModelT::gridlayout_type;
+
+
+    template<typename Fn>
+    static void forRootLevelPatches(Hierarchy& hierarchy, Fn&& fn)
+    {
+        auto& model = *hierarchy.hybridModel;
+        auto level  = hierarchy.basicHierarchy->getHierarchy().getPatchLevel(0);
+
+        for (auto patch : *level)
+        {
+            auto dataOnPatch = model.resourcesManager->setOnPatch(*patch, model.state.ions);
+            auto layout      = layoutFromPatch<GridLayoutT>(*patch);
+            fn(model.state.ions, layout);
+        }
+    }
+
+
+    // the density and flux of each population of each root level patch on its physical nodes,
+    // after the domain particles are deposited and the moment ghosts filled by the messenger
+    static auto rootLevelMoments(Hierarchy& hierarchy)
+    {
+        auto& ions        = hierarchy.hybridModel->state.ions;
+        auto level        = hierarchy.basicHierarchy->getHierarchy().getPatchLevel(0);
+        double const time = 0.;
+
+        forRootLevelPatches(hierarchy, [](auto& ions_, auto& layout) {
+            resetMoments(ions_);
+            depositParticles(ions_, layout, Interpolator<dim, interpOrder>{}, DomainDeposit{});
+        });
+        hierarchy.messenger->fillIonMomentGhosts(ions, *level, time, time);
+
+        std::vector<std::vector<double>> moments;
+        forRootLevelPatches(hierarchy, [&](auto& ions_, auto& layout) {
+            for (auto& pop : ions_)
+            {
+                auto& flux = pop.flux();
+                for (auto* field : {&pop.density(), &flux.getComponent(Component::X),
+                                    &flux.getComponent(Component::Y),
+                                    &flux.getComponent(Component::Z)})
+                {
+                    auto& values = moments.emplace_back();
+                    auto iStart  = layout.physicalStartIndex(*field, Direction::X);
+                    auto iEnd    = layout.physicalEndIndex(*field, Direction::X);
+                    for (auto ix = iStart; ix <= iEnd; ++ix)
+                        values.push_back((*field)(ix));
+                }
+            }
+        });
+        return moments;
+    }
+
+
+    // the largest distance, in cells, between a patch ghost particle and its patch
+    static int patchGhostParticlesDepth(Hierarchy& hierarchy)
+    {
+        int depth = 0;
+        forRootLevelPatches(hierarchy, [&](auto& ions, auto& layout) {
+            auto const box = layout.AMRBox();
+            for (auto& pop : ions)
+                for (auto const& particle : pop.patchGhostParticles())
+                    for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                        depth = std::max({depth, box.lower[iDim] - particle.iCell[iDim],
+                                          particle.iCell[iDim] - box.upper[iDim]});
+        });
+        return depth;
+    }
+};
+
+using InterpOrders = testing::Types<std::integral_constant<std::size_t, 1>,
+                                    std::integral_constant<std::size_t, 2>,
+                                    std::integral_constant<std::size_t, 3>>;
+
+TYPED_TEST_SUITE(HybridHybridMomentGhosts, InterpOrders);
+
+
+
+TYPED_TEST(HybridHybridMomentGhosts, summedOnBordersEqualThoseOfPatchGhostParticles)
+{
+    using Hierarchy = typename TestFixture::Hierarchy;
+
+    // hierarchies are built one after the other, since they register the same SAMRAI objects
+    auto const moments = [](bool const sumBorderMoments) {
+        Hierarchy hierarchy{sumBorderMoments};
+        return TestFixture::rootLevelMoments(hierarchy);
+    };
+
+    auto const deposited = moments(false);
+    auto const summed    = moments(true);
+
+    ASSERT_EQ(deposited.size(), summed.size());
+    for (std::size_t iField = 0; iField < deposited.size(); ++iField)
+    {
+        ASSERT_EQ(deposited[iField].size(), summed[iField].size());
+        for (std::size_t iNode = 0; iNode < deposited[iField].size(); ++iNode)
+            EXPECT_NEAR(deposited[iField][iNode], summed[iField][iNode], 1e-12);
+    }
+}
+
+
+
+TYPED_TEST(HybridHybridMomentGhosts, patchGhostParticlesAreOnlyExchangedNearPatchesIfSummed)
+{
+    using Hierarchy   = typename TestFixture::Hierarchy;
+    using GridLayoutT = typename TestFixture::GridLayoutT;
+
+    auto const depth = [](bool const sumBorderMoments) {
+        Hierarchy hierarchy{sumBorderMoments};
+        return TestFixture::patchGhostParticlesDepth(hierarchy);
+    };
+
+    EXPECT_EQ(static_cast<int>(GridLayoutT::ghostWidthForParticles()), depth(false));
+    EXPECT_EQ(1, depth(true));
+}
+
+
+
+
+// ----------------------------------------------------------------------------
+// The tests below check that the moments of the level ghost particles, that the messenger
+// deposits once per coarse step, give at each substep those of a fresh deposit
+// ----------------------------------------------------------------------------
+
+
+struct LevelGhostMoments : public ::testing::Test
+{
+    static constexpr std::size_t dim         = 1;
+    static constexpr std::size_t interpOrder = 1;
+
+    using Hierarchy   = AfullHybridBasicHierarchy<dim, 2, interpOrder>;
+    using GridLayoutT = typename Hierarchy::HybridModelT::gridlayout_type;
+
+    Hierarchy hierarchy;
+    double const coarseDt = 0.1;
+    double const fineDt   = coarseDt / 2;
+    double time           = 0.;
+
+
+    auto& ions() { return hierarchy.hybridModel->state.ions; }
+
+    auto patchHierarchy() { return hierarchy.basicHierarchy->gridding->getPatchHierarchy(); }
+
+    auto& level(int const levelNumber) { return *patchHierarchy()->getPatchLevel(levelNumber); }
+
+
+    template<typename Fn>
+    void forPatches(int const levelNumber, Fn&& fn)
+    {
+        for (auto patch : level(levelNumber))
+        {
+            auto dataOnPatch = hierarchy.resourcesManagerHybrid->setOnPatch(*patch, ions());
+            auto layout      = layoutFromPatch<GridLayoutT>(*patch);
+            fn(layout);
+        }
+    }
+
+
+    // the density and flux of each population of each patch of the level, on all nodes
+    std::vector<double> levelMoments(int const levelNumber)
+    {
+        std::vector<double> values;
+        forPatches(levelNumber, [&](auto& layout) {
+            for (auto& pop : ions())
+            {
+                auto& flux = pop.flux();
+                for (auto* field : {&pop.density(), &flux.getComponent(Component::X),
+                                    &flux.getComponent(Component::Y),
+                                    &flux.getComponent(Component::Z)})
+                {
+                    auto iStart = layout.ghostStartIndex(*field, Direction::X);
+                    auto iEnd   = layout.ghostEndIndex(*field, Direction::X);
+                    for (auto ix = iStart; ix <= iEnd; ++ix)
+                        values.push_back((*field)(ix));
+                }
+            }
+        });
+        return values;
+    }
+
+
+    // the moments of level 1 obtained by depositing, on zero moments, the particles selected
+    template<typename Select>
+    std::vector<double> deposited(Select&& select)
+    {
+        Interpolator<dim, interpOrder> interpolate;
+        forPatches(1, [&](auto& layout) {
+            resetMoments(ions());
+            for (auto& pop : ions())
+            {
+                auto& particles = select(pop);
+                interpolate(std::begin(particles), std::end(particles), pop.density(), pop.flux(),
+                            layout);
+            }
+        });
+        return levelMoments(1);
+    }
+
+
+    // the coarse level particles change, so that level ghost particles differ at each fill
+    void scaleRootParticleWeights(double const factor)
+    {
+        forPatches(0, [&](auto&) {
+            for (auto& pop : ions())
+                for (auto&& particle : pop.domainParticles())
+                    particle.weight *= factor;
+        });
+        hierarchy.messenger->fillIonGhostParticles(ions(), level(0), time);
+    }
+
+
+    void firstStep()
+    {
+        hierarchy.messenger->firstStep(*hierarchy.hybridModel, level(1), patchHierarchy(), time,
+                                       time, time + coarseDt);
+    }
+
+
+    void lastStep() { hierarchy.messenger->lastStep(*hierarchy.hybridModel, level(1)); }
+
+
+    void regrid()
+    {
+        std::vector<int> const tagBuffer(patchHierarchy()->getMaxNumberOfLevels(), 1);
+        hierarchy.basicHierarchy->gridding->regridAllFinerLevels(0, tagBuffer, 0, time);
+    }
+
+
+    // fills the moment ghosts of level 1 for the substep starting at time, and expects the
+    // moments of the patch ghost particles plus (1-alpha) those of levelGhostParticlesOld and
+    // alpha those of levelGhostParticlesNew, all freshly deposited
+    void expectFreshDepositAtSubstep()
+    {
+        double const alpha = fineDt / coarseDt;
+
+        auto const patchGhost = deposited([](auto& pop) -> auto& {
+            return pop.patchGhostParticles();
+        });
+        auto const levelGhostOld = deposited([](auto& pop) -> auto& {
+            return pop.levelGhostParticlesOld();
+        });
+        auto const levelGhostNew = deposited([](auto& pop) -> auto& {
+            return pop.levelGhostParticlesNew();
+        });
+
+        forPatches(1, [&](auto&) { resetMoments(ions()); });
+        hierarchy.messenger->fillIonMomentGhosts(ions(), level(1), time, time + fineDt);
+        auto const filled = levelMoments(1);
+
+        ASSERT_EQ(filled.size(), patchGhost.size());
+        for (std::size_t i = 0; i < filled.size(); ++i)
+        {
+            auto const expected
+                = patchGhost[i] + (1 - alpha) * levelGhostOld[i] + alpha * levelGhostNew[i];
+            EXPECT_NEAR(expected, filled[i], 1e-12) << "substep starting at " << time;
+        }
+
+        time += fineDt;
+    }
+};
+
+
+
+TEST_F(LevelGhostMoments, areThoseOfAFreshDepositAtEachSubstepOfCoarseSteps)
+{
+    for (std::size_t coarseStep = 0; coarseStep < 3; ++coarseStep)
+    {
+        scaleRootParticleWeights(2.);
+        firstStep();
+
+        expectFreshDepositAtSubstep();
+        expectFreshDepositAtSubstep();
+
+        lastStep();
+    }
+}
+
+
+
+TEST_F(LevelGhostMoments, areThoseOfAFreshDepositAfterARegrid)
+{
+    firstStep();
+    expectFreshDepositAtSubstep();
+    expectFreshDepositAtSubstep();
+    lastStep();
+
+    // the level ghost particles refilled by the regrid differ from those deposited before
+    scaleRootParticleWeights(2.);
+    regrid();
+
+    firstStep();
+    expectFreshDepositAtSubstep();
+    expectFreshDepositAtSubstep();
+    lastStep();
+}
+
+
+
+
 #if 0
 TEST_F(AfullHybridBasicHierarchy, fillsRefinedLevelGhostsAfterRegrid)
 {
@@ -160,6 +160,67 @@ TYPED_TEST(SimulatorTest, returnsCorrecMessengerForEachLevel)
 
 
 
+template<typename Simulator>
+auto magneticFieldAfterOneStep(Simulator& sim)
+{
+    auto& hierarchy   = *sim.hierarchy;
+    auto& hybridModel = *sim.getHybridModel();
+
+    sim.advance(sim.timeStep());
+
+    std::vector<std::vector<double>> values(hierarchy.getNumberOfLevels());
+    for (int iLevel = 0; iLevel < hierarchy.getNumberOfLevels(); ++iLevel)
+    {
+        // patches of the coarsest level may be arranged differently once rebalanced
+        if (iLevel == 0)
+            continue;
+
+        for (auto& patch : *hierarchy.getPatchLevel(iLevel))
+        {
+            auto& B          = hybridModel.state.electromag.B;
+            auto dataOnPatch = hybridModel.resourcesManager->setOnPatch(*patch, B);
+
+            for (auto const component : {Component::X, Component::Y, Component::Z})
+                for (auto const value : B.getComponent(component))
+                    values[iLevel].push_back(value);
+        }
+    }
+    return values;
+}
+
+
+TYPED_TEST(SimulatorTest, fillsFineLevelGhostsAfterTheCoarsestLevelIsRebalanced)
+{
+    auto const expected = [&]() {
+        TypeParam sim;
+        return magneticFieldAfterOneStep(sim);
+    }();
+
+    TypeParam sim;
+    auto& hierarchy = *sim.hierarchy;
+    ASSERT_GE(hierarchy.getNumberOfLevels(), 2);
+
+    // level 0 is replaced by a new level, finer levels are kept
+    auto const formerCoarsestLevel = hierarchy.getPatchLevel(0);
+    sim.rebalanceCoarsestLevel();
+    EXPECT_NE(formerCoarsestLevel, hierarchy.getPatchLevel(0));
+
+    // advancing fills the ghosts of finer levels from the new coarsest level, ghost nodes of
+    // the magnetic field included, and must give what it gives without rebalancing.
+    auto const actual = magneticFieldAfterOneStep(sim);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t iLevel = 1; iLevel < actual.size(); ++iLevel)
+    {
+        ASSERT_EQ(expected[iLevel].size(), actual[iLevel].size());
+        for (std::size_t i = 0; i < actual[iLevel].size(); ++i)
+            EXPECT_NEAR(expected[iLevel][i], actual[iLevel][i], 1e-10);
+    }
+}
+
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -78,6 +78,72 @@ TEST_F(AMaxwellianParticleInitializer1D, loadsParticlesInTheDomain)
 
 
 
+TEST_F(AMaxwellianParticleInitializer1D, loadsTheSameParticlesWithAnyNbrOfThreads)
+{
+    using GridLayoutT       = GridLayout<GridLayoutImplYee<1, 1>>;
+    using InitializerT      = MaxwellianParticleInitializer<ParticleArray<1>, GridLayoutT>;
+    using InitFunctionArray = std::array<InitFunction<1>, 3>;
+
+    auto load = [&](std::size_t nbrThreads) {
+        ThreadPool threadPool{nbrThreads};
+        InitializerT seeded{density, InitFunctionArray{vx, vy, vz},
+                            InitFunctionArray{vthx, vthy, vthz}, 1., 100, 1337, Basis::Cartesian,
+                            InitFunctionArray{nullptr, nullptr, nullptr}, threadPool};
+        ParticleArray<1> loaded;
+        seeded.loadParticles(loaded, layout);
+        return loaded;
+    };
+
+    auto const serial = load(1);
+    EXPECT_EQ(serial.size(), 100 * layout.nbrCells()[0]);
+    EXPECT_EQ(serial.size(), serial.capacity());
+    EXPECT_TRUE(serial == load(4));
+}
+
+
+
+
+TEST_F(AMaxwellianParticleInitializer1D, loadsTheSameParticlesWhateverThePatches)
+{
+    using GridLayoutT       = GridLayout<GridLayoutImplYee<1, 1>>;
+    using InitializerT      = MaxwellianParticleInitializer<ParticleArray<1>, GridLayoutT>;
+    using InitFunctionArray = std::array<InitFunction<1>, 3>;
+
+    InitializerT seeded{density, InitFunctionArray{vx, vy, vz},
+                        InitFunctionArray{vthx, vthy, vthz}, 1., 100, 1337};
+
+    ParticleArray<1> whole, split;
+    seeded.loadParticles(whole, layout);
+    seeded.loadParticles(split, GridLayoutT{{{0.1}}, {{20}}, Point{0.}, Box{Point{50}, Point{69}}});
+    seeded.loadParticles(split, GridLayoutT{{{0.1}}, {{30}}, Point{2.}, Box{Point{70}, Point{99}}});
+
+    ASSERT_EQ(whole.size(), split.size());
+    for (std::size_t i = 0; i < whole.size(); ++i)
+    {
+        EXPECT_EQ(whole[i].iCell, split[i].iCell);
+        EXPECT_EQ(whole[i].delta, split[i].delta);
+        for (std::size_t iComp = 0; iComp < 3; ++iComp) // profiles are evaluated at each patch
+            EXPECT_NEAR(whole[i].v[iComp], split[i].v[iComp], 1e-12);
+    }
+
+    InitializerT otherPopulation{density,
+                                 InitFunctionArray{vx, vy, vz},
+                                 InitFunctionArray{vthx, vthy, vthz},
+                                 1.,
+                                 100,
+                                 1337,
+                                 Basis::Cartesian,
+                                 InitFunctionArray{nullptr, nullptr, nullptr},
+                                 ThreadPool::serial(),
+                                 "alpha"};
+    ParticleArray<1> other;
+    otherPopulation.loadParticles(other, layout);
+    EXPECT_NE(whole[0].delta, other[0].delta);
+}
+
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -6,12 +6,17 @@
 #include "core/data/grid/gridlayoutimplyee.h"
 #include "core/data/ions/particle_initializers/particle_initializer_factory.h"
 #include "core/data/particles/particle_array.h"
+#include "core/utilities/box/box.h"
+#include "core/utilities/point/point.h"
 #include "initializer/data_provider.h"
 
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <type_traits>
 
@@ -50,6 +55,64 @@ TEST(AParticleIinitializerFactory, takesAPHAREDictToCreateAParticleVectorInitial
     auto initializer = ParticleInitializerFactory<ParticleArrayT, GridLayoutT>::create(dict);
 }
 
+
+PHARE::initializer::PHAREDict maxwellianDict(std::string const& basis)
+{
+    auto constant = [](double value) {
+        return PHARE::initializer::InitFunction<1>{[value](std::vector<double> const& x) {
+            return std::make_shared<VectorSpan<double>>(x.size(), value);
+        }};
+    };
+
+    // only the thermal velocity along the first basis vector is not negligible
+    PHARE::initializer::PHAREDict dict;
+    dict["name"]               = std::string{"maxwellian"};
+    dict["density"]            = constant(1.);
+    dict["bulk_velocity_x"]    = constant(0.);
+    dict["bulk_velocity_y"]    = constant(0.);
+    dict["bulk_velocity_z"]    = constant(0.);
+    dict["thermal_velocity_x"] = constant(1.);
+    dict["thermal_velocity_y"] = constant(1e-10);
+    dict["thermal_velocity_z"] = constant(1e-10);
+    dict["magnetic_x"]         = constant(0.);
+    dict["magnetic_y"]         = constant(0.);
+    dict["magnetic_z"]         = constant(2.);
+    dict["charge"]             = 1.;
+    dict["nbr_part_per_cell"]  = int{100};
+    dict["basis"]              = basis;
+    return dict;
+}
+
+
+TEST(AParticleIinitializerFactory, createsAnInitializerInTheLocalMagneticBasis)
+{
+    GridLayoutT layout{{{0.1}}, {{50}}, Point{0.}, Box{Point{50}, Point{99}}};
+    ParticleArrayT particles;
+
+    auto initializer = ParticleInitializerFactory<ParticleArrayT, GridLayoutT>::create(
+        maxwellianDict("magnetic"));
+    initializer->loadParticles(particles, layout);
+
+    ASSERT_EQ(particles.size(), 100 * layout.nbrCells()[0]);
+    double vParallel2 = 0;
+    for (auto const& particle : particles)
+    {
+        EXPECT_NEAR(particle.v[0], 0., 1e-8);
+        EXPECT_NEAR(particle.v[1], 0., 1e-8);
+        vParallel2 += particle.v[2] * particle.v[2];
+    }
+    EXPECT_NEAR(vParallel2 / particles.size(), 1., 0.05); // B is along z
+}
+
+
+TEST(AParticleIinitializerFactory, throwsOnAnUnknownBasis)
+{
+    EXPECT_THROW((ParticleInitializerFactory<ParticleArrayT, GridLayoutT>::create(
+                     maxwellianDict("spherical"))),
+                 std::runtime_error);
+}
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "core/utilities/types.h"
+#include "core/data/particles/particle.h"
+#include "core/data/particles/particle_array.h"
+#include "core/data/particles/particle_cell_index.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace PHARE::core;
+
+template<typename ParticleArray_>
+struct AParticleCellIndex : public ::testing::Test
+{
+    using ParticleArray         = ParticleArray_;
+    static constexpr auto dim   = ParticleArray::dimension;
+    using Box_t                 = Box<int, dim>;
+    static constexpr int lower  = 10;
+    static constexpr int upper  = 19;
+    static constexpr int nbrOut = 3; // cells on each side of the box
+
+    AParticleCellIndex()
+    {
+        std::mt19937 gen{1};
+        std::uniform_int_distribution<int> cell(lower - nbrOut, upper + nbrOut);
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            Particle<dim> particle;
+            particle.weight = i;
+            particle.charge = 1;
+            for (auto& iCell : particle.iCell)
+                iCell = cell(gen);
+            particle.delta = ConstArray<double, dim>(.5);
+            particle.v     = ConstArray<double, 3>(i);
+            particles.push_back(particle);
+        }
+
+        index.build(particles, box);
+    }
+
+    static auto shifted(Point<int, dim> point, int shift)
+    {
+        for (auto& i : point)
+            i += shift;
+        return point;
+    }
+
+    Box_t box{Point{ConstArray<int, dim>(lower)}, Point{ConstArray<int, dim>(upper)}};
+    ParticleArray particles;
+    ParticleCellIndex<dim> index;
+};
+
+
+using ParticleArrays
+    = testing::Types<ParticleArray<1>, ParticleArray<2>, ParticleArray<3>,
+                     ContiguousParticles<1>, ContiguousParticles<2>, ContiguousParticles<3>>;
+
+TYPED_TEST_SUITE(AParticleCellIndex, ParticleArrays);
+
+
+TYPED_TEST(AParticleCellIndex, indexesAllParticles)
+{
+    EXPECT_EQ(this->index.size(), this->particles.size());
+}
+
+
+TYPED_TEST(AParticleCellIndex, visitsTheParticlesOfABoxOnce)
+{
+    using Box_t       = typename TestFixture::Box_t;
+    auto const& lower = this->box.lower;
+    auto const& upper = this->box.upper;
+
+    for (auto const& [query, inside] :
+         {std::make_pair(Box_t{this->shifted(lower, 2), this->shifted(upper, -3)}, true),
+          std::make_pair(Box_t{this->shifted(lower, -2), this->shifted(lower, 1)}, false),
+          std::make_pair(Box_t{this->shifted(upper, 1), this->shifted(upper, 3)}, false)})
+    {
+        std::vector<int> visits(this->particles.size(), 0);
+        this->index.visit(query, [&](std::size_t iPart) { ++visits[iPart]; });
+
+        for (std::size_t iPart = 0; iPart < this->particles.size(); ++iPart)
+        {
+            bool const inQuery = isIn(Point{this->particles[iPart].iCell}, query);
+            if (inQuery or inside) // outside the indexed box, candidates are visited too
+                EXPECT_EQ(visits[iPart], inQuery ? 1 : 0);
+            else
+                EXPECT_LE(visits[iPart], 1);
+        }
+    }
+}
+
+
+TYPED_TEST(AParticleCellIndex, visitsTheParticlesOfACellInArrayOrder)
+{
+    using Box_t = typename TestFixture::Box_t;
+
+    auto inBox = std::find_if(std::begin(this->particles), std::end(this->particles),
+                              [&](auto const& particle) {
+                                  return isIn(Point{particle.iCell}, this->box);
+                              });
+    ASSERT_NE(inBox, std::end(this->particles));
+    auto const cell = Point{inBox->iCell};
+
+    std::vector<std::size_t> visited;
+    this->index.visit(Box_t{cell, cell}, [&](std::size_t iPart) { visited.push_back(iPart); });
+
+    std::vector<std::size_t> expected;
+    for (std::size_t iPart = 0; iPart < this->particles.size(); ++iPart)
+        if (Point{this->particles[iPart].iCell} == cell)
+            expected.push_back(iPart);
+
+    EXPECT_EQ(visited, expected);
+}
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,5 +1,8 @@
 
 
+#include <algorithm>
+#include <iterator>
+
 #include "core/utilities/types.h"
 #include "core/data/particles/particle.h"
 #include "core/data/particles/particle_array.h"
@@ -63,6 +66,87 @@ TYPED_TEST(ParticleListTest, SoAandAoSInterop)
         EXPECT_EQ(particle, particleArray[i++]);
 }
 
+
+TYPED_TEST(ParticleListTest, SoAContainerInterface)
+{
+    using Particle     = TypeParam;
+    constexpr auto dim = Particle::dimension;
+
+    ContiguousParticles<dim> particles;
+    EXPECT_EQ(particles.size(), 0);
+
+    for (std::size_t i = 0; i < 10; i++)
+    {
+        Particle particle;
+        particle.weight = i;
+        particle.charge = 1;
+        particle.iCell  = ConstArray<int, dim>(i);
+        particle.delta  = ConstArray<double, dim>(.5);
+        particle.v      = ConstArray<double, 3>(i + 1);
+        particles.push_back(particle);
+        EXPECT_EQ(particles.back(), particle);
+    }
+    EXPECT_EQ(particles.size(), 10);
+    EXPECT_EQ(particles.iCell.size(), 10 * dim);
+
+    // views write through to the array
+    particles[3].weight = 33;
+    EXPECT_EQ(particles.weight[3], 33);
+
+    // std algorithms work through the proxy iterator
+    auto isEven = [](auto const& particle) { return particle.iCell[0] % 2 == 0; };
+    auto pivot  = std::partition(std::begin(particles), std::end(particles), isEven);
+    EXPECT_EQ(std::distance(std::begin(particles), pivot), 5);
+    EXPECT_TRUE(std::all_of(std::begin(particles), pivot, isEven));
+    EXPECT_TRUE(std::none_of(pivot, std::end(particles), isEven));
+    for (auto const& particle : particles) // particle state is kept together by the swap
+        EXPECT_EQ(particle.v[0], particle.iCell[0] + 1);
+
+    particles.erase(pivot, std::end(particles));
+    EXPECT_EQ(particles.size(), 5);
+    EXPECT_EQ(particles.v.size(), 5 * 3);
+
+    ContiguousParticles<dim> copy;
+    std::copy(std::begin(particles), std::end(particles), std::back_inserter(copy));
+    EXPECT_EQ(copy, particles);
+
+    copy.insert(std::end(copy), std::begin(particles), std::end(particles));
+    EXPECT_EQ(copy.size(), 10);
+    EXPECT_EQ(copy[7], particles[2]);
+
+    swap(copy, particles);
+    EXPECT_EQ(particles.size(), 10);
+    empty(copy);
+    EXPECT_EQ(copy.size(), 0);
+}
+
+
+TYPED_TEST(ParticleListTest, SoAConstAccessGivesReadOnlyViews)
+{
+    using Particle     = TypeParam;
+    constexpr auto dim = Particle::dimension;
+    using Particles    = ContiguousParticles<dim>;
+
+    Particles particles{3, Particle{1., 1.}};
+    auto const& constParticles = particles;
+
+    using ConstView     = typename Particles::const_view_type;
+    using ConstIterator = typename Particles::const_iterator;
+    static_assert(std::is_same_v<decltype(constParticles[0]), ConstView>);
+    static_assert(std::is_same_v<decltype(*particles.cbegin()), ConstView>);
+    static_assert(std::is_same_v<decltype(constParticles.begin()), ConstIterator>);
+    static_assert(std::is_const_v<std::remove_reference_t<decltype(constParticles[0].weight)>>);
+    static_assert(std::is_const_v<std::remove_reference_t<decltype(constParticles[0].v)>>);
+
+    particles[1].weight = 2;
+    EXPECT_EQ(constParticles[1].weight, 2);
+    EXPECT_EQ(std::copy(constParticles[1]), particles[1]);
+
+    ConstIterator first = std::begin(particles);
+    EXPECT_TRUE(first == particles.cbegin());
+    EXPECT_EQ(std::distance(first, particles.cend()), 3);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
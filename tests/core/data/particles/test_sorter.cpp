@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "core/utilities/types.h"
+#include "core/data/particles/particle.h"
+#include "core/data/particles/particle_array.h"
+#include "core/data/particles/particle_sorter.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace PHARE::core;
+
+template<typename ParticleArray_>
+struct AParticleSorter : public ::testing::Test
+{
+    using ParticleArray         = ParticleArray_;
+    static constexpr auto dim   = ParticleArray::dimension;
+    static constexpr int lower  = 10;
+    static constexpr int upper  = 19;
+    static constexpr int nbrOut = 3; // cells on each side of the box
+
+    AParticleSorter()
+    {
+        std::mt19937 gen{1};
+        std::uniform_int_distribution<int> cell(lower - nbrOut, upper + nbrOut);
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            Particle<dim> particle;
+            particle.weight = i; // used to check stability
+            particle.charge = 1;
+            for (auto& iCell : particle.iCell)
+                iCell = cell(gen);
+            particle.delta = ConstArray<double, dim>(.5);
+            particle.v     = ConstArray<double, 3>(i);
+            particles.push_back(particle);
+        }
+    }
+
+    Box<int, dim> box{Point{ConstArray<int, dim>(lower)}, Point{ConstArray<int, dim>(upper)}};
+    ParticleArray particles;
+    ParticleSorter<ParticleArray> sorter;
+};
+
+// cells of the box, in the order they are sorted
+template<std::size_t dim>
+auto cellsOf(Box<int, dim> const& box)
+{
+    std::vector<Point<int, dim>> cells{box.lower};
+    for (int iDim = dim - 1; iDim >= 0; --iDim)
+    {
+        std::vector<Point<int, dim>> next;
+        for (auto const& cell : cells)
+            for (int i = box.lower[iDim]; i <= box.upper[iDim]; ++i)
+            {
+                auto copy  = cell;
+                copy[iDim] = i;
+                next.push_back(copy);
+            }
+        cells = next;
+    }
+    std::sort(std::begin(cells), std::end(cells), [](auto const& a, auto const& b) {
+        return std::lexicographical_compare(std::begin(a), std::end(a), std::begin(b), std::end(b));
+    });
+    return cells;
+}
+
+
+using ParticleArrays
+    = testing::Types<ParticleArray<1>, ParticleArray<2>, ParticleArray<3>,
+                     ContiguousParticles<1>, ContiguousParticles<2>, ContiguousParticles<3>>;
+
+TYPED_TEST_SUITE(AParticleSorter, ParticleArrays);
+
+
+TYPED_TEST(AParticleSorter, keepsAllParticles)
+{
+    auto const nbrParticles = this->particles.size();
+    this->sorter(this->particles, this->box);
+
+    EXPECT_EQ(this->particles.size(), nbrParticles);
+    EXPECT_EQ(this->sorter.offsets().back(), nbrParticles);
+    for (auto const& particle : this->particles) // particle state is moved as a whole
+        EXPECT_EQ(particle.v[0], particle.weight);
+}
+
+
+TYPED_TEST(AParticleSorter, givesTheParticlesOfEachCellInOriginalOrder)
+{
+    this->sorter(this->particles, this->box);
+
+    std::size_t nbrInBox = 0;
+    for (auto const& particle : this->particles)
+        nbrInBox += isIn(Point{particle.iCell}, this->box);
+
+    std::size_t nbrInRanges = 0;
+    auto firstInCell        = std::begin(this->particles);
+    for (auto const& cell : cellsOf(this->box))
+    {
+        auto range = this->sorter.cellRange(this->particles, cell);
+        EXPECT_EQ(range.begin(), firstInCell); // cells are contiguous and ordered
+        firstInCell = range.end();
+
+        double lastWeight = -1;
+        for (auto const& particle : range)
+        {
+            EXPECT_EQ(Point{particle.iCell}, cell);
+            EXPECT_GT(particle.weight, lastWeight);
+            lastWeight = particle.weight;
+            ++nbrInRanges;
+        }
+    }
+    EXPECT_EQ(nbrInRanges, nbrInBox);
+
+    auto outside = this->sorter.outsideRange(this->particles);
+    EXPECT_EQ(outside.size(), this->particles.size() - nbrInBox);
+    for (auto const& particle : outside)
+        EXPECT_FALSE(isIn(Point{particle.iCell}, this->box));
+}
+
+
+TYPED_TEST(AParticleSorter, leavesSortedParticlesUntouched)
+{
+    this->sorter(this->particles, this->box);
+    auto sorted  = this->particles;
+    auto offsets = this->sorter.offsets();
+
+    this->sorter(this->particles, this->box);
+
+    EXPECT_EQ(this->particles, sorted);
+    EXPECT_EQ(this->sorter.offsets(), offsets);
+}
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
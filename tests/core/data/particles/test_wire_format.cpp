@@ -0,0 +1,179 @@
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "core/utilities/types.h"
+#include "core/data/particles/particle.h"
+#include "core/data/particles/particle_wire_format.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace PHARE::core;
+
+
+// the pack/unpack interface of SAMRAI::tbox::MessageStream, on a byte vector
+struct ByteStream
+{
+    template<typename T>
+    void pack(T const* data, std::size_t size)
+    {
+        auto const bytes = reinterpret_cast<char const*>(data);
+        buffer.insert(std::end(buffer), bytes, bytes + size * sizeof(T));
+    }
+
+    template<typename T>
+    void unpack(T* data, std::size_t size)
+    {
+        std::memcpy(data, buffer.data() + cursor, size * sizeof(T));
+        cursor += size * sizeof(T);
+    }
+
+    std::vector<char> buffer;
+    std::size_t cursor = 0;
+};
+
+
+
+template<typename Dimension>
+struct AParticleWireFormat : public ::testing::Test
+{
+    static constexpr auto dim = Dimension::value;
+    using WireFormat          = ParticleWireFormat<dim>;
+
+    AParticleWireFormat()
+    {
+        std::mt19937 gen{1};
+        std::uniform_int_distribution<int> cell(box.lower[0], box.upper[0]);
+        ParticleDeltaDistribution<double> delta;
+        std::normal_distribution<double> v;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            Particle<dim> particle;
+            particle.weight = .001 * i;
+            particle.charge = i % 2 ? 1 : 2;
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                particle.iCell[iDim] = cell(gen);
+                particle.delta[iDim] = delta(gen);
+            }
+            particle.v = {v(gen), v(gen), v(gen)};
+            particles.push_back(particle);
+        }
+        particles[0].delta = ConstArray<double, dim>(1. - 1e-12); // rounds to 1 as a float
+        particles[1].delta = ConstArray<double, dim>(0.);
+        particles[2].iCell = box.lower.template toArray<int>();
+        particles[3].iCell = box.upper.template toArray<int>();
+    }
+
+    auto roundTrip(DeltaEncoding encoding)
+    {
+        ByteStream stream;
+        WireFormat writer{box, encoding};
+        writer.write(stream, particles);
+        EXPECT_EQ(writer.size(particles.size()), stream.buffer.size());
+
+        auto const read = WireFormat{box}.read(stream);
+        EXPECT_EQ(stream.cursor, stream.buffer.size());
+        return read;
+    }
+
+    void expectSameButDeltas(std::vector<Particle<dim>> const& read, double tolerance)
+    {
+        ASSERT_EQ(particles.size(), read.size());
+        for (std::size_t i = 0; i < particles.size(); ++i)
+        {
+            EXPECT_EQ(particles[i].weight, read[i].weight);
+            EXPECT_EQ(particles[i].charge, read[i].charge);
+            EXPECT_EQ(particles[i].iCell, read[i].iCell);
+            EXPECT_EQ(particles[i].v, read[i].v);
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                EXPECT_NEAR(particles[i].delta[iDim], read[i].delta[iDim], tolerance);
+                EXPECT_GE(read[i].delta[iDim], 0.);
+                EXPECT_LT(read[i].delta[iDim], 1.);
+            }
+        }
+    }
+
+    Box<int, dim> box{Point{ConstArray<int, dim>(-7)}, Point{ConstArray<int, dim>(120)}};
+    std::vector<Particle<dim>> particles;
+};
+
+using Dimensions = testing::Types<std::integral_constant<std::size_t, 1>,
+                                  std::integral_constant<std::size_t, 2>,
+                                  std::integral_constant<std::size_t, 3>>;
+
+TYPED_TEST_SUITE(AParticleWireFormat, Dimensions);
+
+
+
+
+TYPED_TEST(AParticleWireFormat, sendsParticlesExactlyWithDoubleDeltas)
+{
+    auto const read = this->roundTrip(DeltaEncoding::Double);
+    EXPECT_TRUE(read == this->particles);
+}
+
+
+TYPED_TEST(AParticleWireFormat, sendsDeltasInTheCellWithFloat32)
+{
+    this->expectSameButDeltas(this->roundTrip(DeltaEncoding::Float32), 1. / (1 << 24));
+}
+
+
+TYPED_TEST(AParticleWireFormat, sendsDeltasInTheCellWithFixed16)
+{
+    this->expectSameButDeltas(this->roundTrip(DeltaEncoding::Fixed16), 1. / (1 << 17));
+}
+
+
+TYPED_TEST(AParticleWireFormat, isSmallerThanRawParticles)
+{
+    constexpr auto dim = TestFixture::dim;
+    auto const n       = this->particles.size();
+
+    for (auto encoding : {DeltaEncoding::Double, DeltaEncoding::Float32, DeltaEncoding::Fixed16})
+        EXPECT_LT(ParticleWireFormat<dim>(this->box, encoding).size(n), n * sizeof(Particle<dim>));
+}
+
+
+TYPED_TEST(AParticleWireFormat, sendsCellsOf32BitsBeyond65536Cells)
+{
+    constexpr auto dim = TestFixture::dim;
+    using WireFormat   = typename TestFixture::WireFormat;
+
+    Box<int, dim> large{this->box};
+    large.upper[0]              = large.lower[0] + 70000;
+    this->particles[3].iCell[0] = large.upper[0];
+    auto const n                = this->particles.size();
+
+    EXPECT_EQ(WireFormat(large, DeltaEncoding::Double).size(n),
+              WireFormat(this->box, DeltaEncoding::Double).size(n) + n * dim * 2);
+
+    ByteStream stream;
+    WireFormat{large, DeltaEncoding::Double}.write(stream, this->particles);
+    EXPECT_TRUE(WireFormat{large}.read(stream) == this->particles);
+}
+
+
+TEST(ParticleWireFormat, refusesOtherVersions)
+{
+    ParticleWireFormat<1> const wireFormat{Box{Point{0}, Point{9}}};
+
+    ByteStream stream;
+    wireFormat.write(stream, std::vector<Particle<1>>{});
+    stream.buffer[0] = ParticleWireFormat<1>::version + 1;
+    EXPECT_THROW(wireFormat.read(stream), std::runtime_error);
+}
+
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -87,6 +87,34 @@ TYPED_TEST(AWeighter, ComputesWeightThatSumIsOne)
 
 
 
+TYPED_TEST(AWeighter, batchedWeightsAreThoseOfSingleParticle)
+{
+    constexpr std::size_t N         = 8;
+    constexpr std::size_t nbrPoints = nbrPointsSupport(TypeParam::interp_order);
+
+    std::array<double, N> positions;
+    std::array<int, N> startIndexes;
+    std::array<std::array<double, N>, nbrPoints> weights;
+
+    for (std::size_t first = 0; first + N <= 1000; first += N)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            positions[i]    = this->normalizedPositions[first + i];
+            startIndexes[i] = computeStartIndex<TypeParam::interp_order>(positions[i]);
+        }
+
+        TypeParam::computeWeights(positions, startIndexes, weights);
+
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t ik = 0; ik < nbrPoints; ++ik)
+                EXPECT_DOUBLE_EQ(weights[ik][i], this->weights_[first + i][ik]);
+    }
+}
+
+
+
+
 TEST(Weights, NbrPointsInBSplineSupportIsCorrect)
 {
     EXPECT_EQ(2, nbrPointsSupport(1));
@@ -247,32 +275,67 @@ TYPED_TEST(A1DInterpolator, canComputeAllEMfieldsAtParticle)
     this->em.B.setBuffer("EM_B_y", &this->by1d_);
     this->em.B.setBuffer("EM_B_z", &this->bz1d_);
 
-    this->interp(std::begin(this->particles), std::end(this->particles), this->em, this->layout);
+    auto const tol = 1e-8;
+    for (auto const& part : this->particles)
+    {
+        auto const& [E, B] = this->interp(part, this->em, this->layout);
+
+        EXPECT_NEAR(E[0], this->ex0, tol);
+        EXPECT_NEAR(E[1], this->ey0, tol);
+        EXPECT_NEAR(E[2], this->ez0, tol);
+        EXPECT_NEAR(B[0], this->bx0, tol);
+        EXPECT_NEAR(B[1], this->by0, tol);
+        EXPECT_NEAR(B[2], this->bz0, tol);
+    }
 
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<1> const& part) { return std::abs(part.Ex - this->ex0) < 1e-8; }));
 
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<1> const& part) { return std::abs(part.Ey - this->ey0) < 1e-8; }));
+    this->em.E.setBuffer("EM_E_x", nullptr);
+    this->em.E.setBuffer("EM_E_y", nullptr);
+    this->em.E.setBuffer("EM_E_z", nullptr);
+    this->em.B.setBuffer("EM_B_x", nullptr);
+    this->em.B.setBuffer("EM_B_y", nullptr);
+    this->em.B.setBuffer("EM_B_z", nullptr);
+}
 
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<1> const& part) { return std::abs(part.Ez - this->ez0) < 1e-8; }));
 
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<1> const& part) { return std::abs(part.Bx - this->bx0) < 1e-8; }));
 
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<1> const& part) { return std::abs(part.By - this->by0) < 1e-8; }));
+TYPED_TEST(A1DInterpolator, batchedGatherIsSameAsParticleGather)
+{
+    this->em.E.setBuffer("EM_E_x", &this->ex1d_);
+    this->em.E.setBuffer("EM_E_y", &this->ey1d_);
+    this->em.E.setBuffer("EM_E_z", &this->ez1d_);
+    this->em.B.setBuffer("EM_B_x", &this->bx1d_);
+    this->em.B.setBuffer("EM_B_y", &this->by1d_);
+    this->em.B.setBuffer("EM_B_z", &this->bz1d_);
+
+    for (auto ix = 0u; ix < this->nx; ++ix) // make fields vary so weights matter
+    {
+        this->ex1d_(ix) = this->bx1d_(ix) = std::cos(ix * 0.3);
+        this->ey1d_(ix) = this->by1d_(ix) = std::sin(ix * 0.2);
+        this->ez1d_(ix) = this->bz1d_(ix) = ix * 0.1;
+    }
+
+    constexpr std::size_t N = TypeParam::batch_size;
+    this->particles.resize(N - 1); // partial batch
+    for (std::size_t i = 0; i < this->particles.size(); ++i)
+    {
+        this->particles[i].iCell[0] = 10 + i;
+        this->particles[i].delta[0] = 0.1 * i;
+    }
 
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<1> const& part) { return std::abs(part.Bz - this->bz0) < 1e-8; }));
+    std::array<std::array<double, N>, 3> E, B;
+    this->interp.gather(std::begin(this->particles), this->particles.size(), this->em,
+                        this->layout, E, B);
 
+    for (std::size_t i = 0; i < this->particles.size(); ++i)
+    {
+        auto const& [pE, pB] = this->interp(this->particles[i], this->em, this->layout);
+        for (std::size_t iComp = 0; iComp < 3; ++iComp)
+        {
+            EXPECT_DOUBLE_EQ(E[iComp][i], pE[iComp]);
+            EXPECT_DOUBLE_EQ(B[iComp][i], pB[iComp]);
+        }
+    }
 
     this->em.E.setBuffer("EM_E_x", nullptr);
     this->em.E.setBuffer("EM_E_y", nullptr);
@@ -284,6 +347,7 @@ TYPED_TEST(A1DInterpolator, canComputeAllEMfieldsAtParticle)
 
 
 
+
 template<typename InterpolatorT>
 class A2DInterpolator : public ::testing::Test
 {
@@ -362,31 +426,18 @@ TYPED_TEST(A2DInterpolator, canComputeAllEMfieldsAtParticle)
     this->em.B.setBuffer("EM_B_y", &this->by_);
     this->em.B.setBuffer("EM_B_z", &this->bz_);
 
-    this->interp(std::begin(this->particles), std::end(this->particles), this->em, this->layout);
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<2> const& part) { return std::abs(part.Ex - this->ex0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<2> const& part) { return std::abs(part.Ey - this->ey0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<2> const& part) { return std::abs(part.Ez - this->ez0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<2> const& part) { return std::abs(part.Bx - this->bx0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<2> const& part) { return std::abs(part.By - this->by0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<2> const& part) { return std::abs(part.Bz - this->bz0) < 1e-8; }));
+    auto const tol = 1e-8;
+    for (auto const& part : this->particles)
+    {
+        auto const& [E, B] = this->interp(part, this->em, this->layout);
+
+        EXPECT_NEAR(E[0], this->ex0, tol);
+        EXPECT_NEAR(E[1], this->ey0, tol);
+        EXPECT_NEAR(E[2], this->ez0, tol);
+        EXPECT_NEAR(B[0], this->bx0, tol);
+        EXPECT_NEAR(B[1], this->by0, tol);
+        EXPECT_NEAR(B[2], this->bz0, tol);
+    }
 
 
     this->em.E.setBuffer("EM_E_x", nullptr);
@@ -482,31 +533,18 @@ TYPED_TEST(A3DInterpolator, canComputeAllEMfieldsAtParticle)
     this->em.B.setBuffer("EM_B_y", &this->by_);
     this->em.B.setBuffer("EM_B_z", &this->bz_);
 
-    this->interp(std::begin(this->particles), std::end(this->particles), this->em, this->layout);
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<3> const& part) { return std::abs(part.Ex - this->ex0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<3> const& part) { return std::abs(part.Ey - this->ey0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<3> const& part) { return std::abs(part.Ez - this->ez0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<3> const& part) { return std::abs(part.Bx - this->bx0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<3> const& part) { return std::abs(part.By - this->by0) < 1e-8; }));
-
-    EXPECT_TRUE(std::all_of(
-        std::begin(this->particles), std::end(this->particles),
-        [this](Particle<3> const& part) { return std::abs(part.Bz - this->bz0) < 1e-8; }));
+    auto const tol = 1e-8;
+    for (auto const& part : this->particles)
+    {
+        auto const& [E, B] = this->interp(part, this->em, this->layout);
+
+        EXPECT_NEAR(E[0], this->ex0, tol);
+        EXPECT_NEAR(E[1], this->ey0, tol);
+        EXPECT_NEAR(E[2], this->ez0, tol);
+        EXPECT_NEAR(B[0], this->bx0, tol);
+        EXPECT_NEAR(B[1], this->by0, tol);
+        EXPECT_NEAR(B[2], this->bz0, tol);
+    }
 
 
     this->em.E.setBuffer("EM_E_x", nullptr);
@@ -511,7 +511,7 @@ struct IonUpdaterTest : public ::testing::Test
                 //     -------|-------|     |
                 //            ---------------
                 std::transform(std::begin(levelGhostPartOld), std::end(levelGhostPartOld),
-                               std::begin(levelGhostPartOld), [](auto& part) {
+                               std::begin(levelGhostPartOld), [](auto&& part) {
                                    if constexpr (interp_order == 2 or interp_order == 3)
                                    {
                                        part.iCell[0] = part.iCell[0] - 2;
@@ -551,7 +551,7 @@ struct IonUpdaterTest : public ::testing::Test
 
 
                 std::transform(std::begin(patchGhostPart), std::end(patchGhostPart),
-                               std::begin(patchGhostPart), [](auto& part) {
+                               std::begin(patchGhostPart), [](auto&& part) {
                                    if constexpr (interp_order == 2 or interp_order == 3)
                                    {
                                        part.iCell[0] = part.iCell[0] + 2;
@@ -860,11 +860,13 @@ TYPED_TEST(IonUpdaterTest, particlesUntouchedInMomentOnlyMode)
         }
     };
 
+    checkIsUnTouched(populations[0].domainParticles(), ionsBufferCpy.protonDomain);
     checkIsUnTouched(populations[0].patchGhostParticles(), ionsBufferCpy.protonPatchGhost);
     checkIsUnTouched(populations[0].levelGhostParticles(), ionsBufferCpy.protonLevelGhost);
     checkIsUnTouched(populations[0].levelGhostParticlesOld(), ionsBufferCpy.protonLevelGhostOld);
     checkIsUnTouched(populations[0].levelGhostParticlesNew(), ionsBufferCpy.protonLevelGhostNew);
 
+    checkIsUnTouched(populations[1].domainParticles(), ionsBufferCpy.alphaDomain);
     checkIsUnTouched(populations[1].patchGhostParticles(), ionsBufferCpy.alphaPatchGhost);
     checkIsUnTouched(populations[1].levelGhostParticles(), ionsBufferCpy.alphaLevelGhost);
     checkIsUnTouched(populations[1].levelGhostParticlesOld(), ionsBufferCpy.alphaLevelGhost);
@@ -873,6 +875,37 @@ TYPED_TEST(IonUpdaterTest, particlesUntouchedInMomentOnlyMode)
 
 
 
+TYPED_TEST(IonUpdaterTest, predictedParticlesAreOnlyThoseNearThePatchBorder)
+{
+    typename IonUpdaterTest<TypeParam>::IonUpdater ionUpdater{
+        init_dict["simulation"]["algo"]["ion_updater"]};
+
+    ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt,
+                                 UpdaterMode::domain_only);
+
+    auto constexpr dim        = TypeParam::dimension;
+    auto constexpr ghostWidth = static_cast<int>(
+        IonUpdaterTest<TypeParam>::GridLayout::ghostWidthForParticles());
+
+    auto interiorBox = this->layout.AMRBox();
+    for (std::size_t iDim = 0; iDim < dim; ++iDim)
+    {
+        interiorBox.lower[iDim] += ghostWidth;
+        interiorBox.upper[iDim] -= ghostWidth;
+    }
+
+    for (std::size_t iPop = 0; iPop < this->ions.nbrPopulations(); ++iPop)
+    {
+        auto const& predicted = ionUpdater.predictedParticles(iPop);
+
+        EXPECT_GT(predicted.size(), 0u);
+        for (auto const& particle : predicted)
+            EXPECT_FALSE(isIn(cellAsPoint(particle), interiorBox));
+    }
+}
+
+
+
 
 // TYPED_TEST(IonUpdaterTest, particlesAreChangedInParticlesAndMomentsMode)
 //{
@@ -919,6 +952,230 @@ TYPED_TEST(IonUpdaterTest, momentsAreChangedInParticlesAndMomentsMode)
 
 
 
+TYPED_TEST(IonUpdaterTest, scratchArraysAreNotReallocatedInSteadyState)
+{
+    using IonUpdater = typename IonUpdaterTest<TypeParam>::IonUpdater;
+
+    for (std::size_t nbrThreads : {1, 2})
+    {
+        auto dict           = init_dict["simulation"]["algo"]["ion_updater"];
+        dict["nbr_threads"] = nbrThreads;
+        IonUpdater ionUpdater{dict};
+
+        // particles are left untouched in this mode, so each update needs the same buffers
+        ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt,
+                                     UpdaterMode::domain_only);
+        auto const stats = ionUpdater.scratchStats();
+        EXPECT_GT(stats.nbrAllocations, 0u);
+        EXPECT_GT(stats.nbrParticles, 0u);
+
+        for (std::size_t step = 0; step < 3; ++step)
+            ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt,
+                                         UpdaterMode::domain_only);
+
+        EXPECT_EQ(stats.nbrAllocations, ionUpdater.scratchStats().nbrAllocations);
+        EXPECT_EQ(stats.nbrParticles, ionUpdater.scratchStats().nbrParticles);
+    }
+}
+
+
+
+TYPED_TEST(IonUpdaterTest, sortsDomainParticlesByCellEveryIntervalSteps)
+{
+    using IonUpdater = typename IonUpdaterTest<TypeParam>::IonUpdater;
+
+    EXPECT_FALSE(IonUpdater{init_dict["simulation"]["algo"]["ion_updater"]}.sortIsDue(0));
+
+    auto dict                = init_dict["simulation"]["algo"]["ion_updater"];
+    dict["sort"]["interval"] = std::size_t{2};
+    IonUpdater ionUpdater{dict};
+    EXPECT_TRUE(ionUpdater.sortIsDue(4));
+    EXPECT_FALSE(ionUpdater.sortIsDue(3));
+
+    ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt, UpdaterMode::all);
+
+    std::vector<std::size_t> nbrParticles;
+    for (auto& pop : this->ions)
+        nbrParticles.push_back(pop.domainParticles().size());
+
+    ionUpdater.sortPopulations(this->ions, this->layout);
+
+    std::size_t iPop = 0;
+    for (auto& pop : this->ions)
+    {
+        auto& particles = pop.domainParticles();
+        EXPECT_EQ(particles.size(), nbrParticles[iPop++]);
+        EXPECT_TRUE(std::is_sorted(std::begin(particles), std::end(particles),
+                                   [](auto const& particle0, auto const& particle1) {
+                                       return particle0.iCell < particle1.iCell;
+                                   }));
+    }
+}
+
+
+
+
+TYPED_TEST(IonUpdaterTest, threadedUpdateGivesSameMomentsAsSerialUpdate)
+{
+    using IonUpdater           = typename IonUpdaterTest<TypeParam>::IonUpdater;
+    using Ions                 = typename IonUpdaterTest<TypeParam>::Ions;
+    constexpr auto dim         = TypeParam::dimension;
+    constexpr auto interpOrder = TypeParam::interp_order;
+
+    auto dict           = init_dict["simulation"]["algo"]["ion_updater"];
+    dict["nbr_threads"] = std::size_t{3};
+
+    // the batched pusher pushes and deposits domain particles in a single pass
+    for (auto const& [pusherName, mode] :
+         {std::make_pair("modified_boris", UpdaterMode::domain_only),
+          std::make_pair("modified_boris", UpdaterMode::all),
+          std::make_pair("modified_boris_simd", UpdaterMode::domain_only),
+          std::make_pair("modified_boris_simd", UpdaterMode::all)})
+    {
+        dict["pusher"]["name"] = std::string{pusherName};
+
+        // each threaded update works on its own copy of the initial ions
+        std::array<IonsBuffers<dim, interpOrder>, 2> buffers{
+            IonsBuffers<dim, interpOrder>{this->ionsBuffers, this->layout},
+            IonsBuffers<dim, interpOrder>{this->ionsBuffers, this->layout}};
+        std::array<Ions, 2> threadedIons{Ions{init_dict["ions"]}, Ions{init_dict["ions"]}};
+
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            buffers[i].setBuffers(threadedIons[i]);
+            IonUpdater{dict}.updatePopulations(threadedIons[i], this->EM, this->layout, this->dt,
+                                               mode);
+        }
+
+        IonsBuffers<dim, interpOrder> serialBuffers{this->ionsBuffers, this->layout};
+        Ions serialIons{init_dict["ions"]};
+        serialBuffers.setBuffers(serialIons);
+        IonUpdater{init_dict["simulation"]["algo"]["ion_updater"]}.updatePopulations(
+            serialIons, this->EM, this->layout, this->dt, mode);
+
+        auto check = [](auto const& field, auto const& expected, auto const& reproduced) {
+            for (std::size_t i = 0; i < field.size(); ++i)
+            {
+                EXPECT_NEAR(field.data()[i], expected.data()[i], 1e-12);
+                EXPECT_EQ(field.data()[i], reproduced.data()[i]); // deterministic
+            }
+        };
+
+        for (std::size_t iPop = 0; iPop < serialIons.nbrPopulations(); ++iPop)
+        {
+            auto& pop       = threadedIons[0].getRunTimeResourcesUserList()[iPop];
+            auto& reproPop  = threadedIons[1].getRunTimeResourcesUserList()[iPop];
+            auto& serialPop = serialIons.getRunTimeResourcesUserList()[iPop];
+
+            EXPECT_EQ(pop.domainParticles().size(), serialPop.domainParticles().size());
+            check(pop.density(), serialPop.density(), reproPop.density());
+            for (auto component : {Component::X, Component::Y, Component::Z})
+                check(pop.flux().getComponent(component),
+                      serialPop.flux().getComponent(component),
+                      reproPop.flux().getComponent(component));
+        }
+    }
+}
+
+
+
+
+TYPED_TEST(IonUpdaterTest, maxCellCrossingBoundsTheSpeedOfTheDomainParticles)
+{
+    using IonUpdater = typename IonUpdaterTest<TypeParam>::IonUpdater;
+
+    IonUpdater ionUpdater{init_dict["simulation"]["algo"]["ion_updater"]};
+    auto const& meshSize = this->layout.meshSize();
+    auto const minDl     = *std::min_element(std::begin(meshSize), std::end(meshSize));
+
+    auto const crossing = ionUpdater.maxCellCrossing(this->ions, this->EM, this->layout, this->dt);
+    EXPECT_LT(crossing, 1.); // the split-phase push applies to the particles of the test
+
+    for (auto& pop : this->ions)
+        for (auto const& particle : pop.domainParticles())
+        {
+            auto const& v = particle.v;
+            EXPECT_LE(std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) * this->dt / minDl,
+                      crossing);
+        }
+
+    auto&& fast = this->ions.getRunTimeResourcesUserList()[0].domainParticles()[0];
+    fast.v[0]   = 2 * minDl / this->dt;
+    EXPECT_GE(ionUpdater.maxCellCrossing(this->ions, this->EM, this->layout, this->dt), 2.);
+}
+
+
+
+
+TYPED_TEST(IonUpdaterTest, splitPushGivesTheSameParticlesAndMomentsAsUpdatePopulations)
+{
+    using IonUpdater           = typename IonUpdaterTest<TypeParam>::IonUpdater;
+    using Ions                 = typename IonUpdaterTest<TypeParam>::Ions;
+    using AsideParticles       = typename IonUpdater::AsideParticles;
+    constexpr auto dim         = TypeParam::dimension;
+    constexpr auto interpOrder = TypeParam::interp_order;
+
+    auto const& dict = init_dict["simulation"]["algo"]["ion_updater"];
+
+    // particles are pushed in another order, so they are compared sorted
+    auto sorted = [](auto const& particles) {
+        std::vector<Particle<dim>> copy(std::begin(particles), std::end(particles));
+        std::sort(std::begin(copy), std::end(copy), [](auto const& a, auto const& b) {
+            return std::tie(a.iCell, a.delta, a.v, a.weight)
+                   < std::tie(b.iCell, b.delta, b.v, b.weight);
+        });
+        return copy;
+    };
+
+    for (auto mode : {UpdaterMode::domain_only, UpdaterMode::all})
+    {
+        IonsBuffers<dim, interpOrder> splitBuffers{this->ionsBuffers, this->layout};
+        Ions splitIons{init_dict["ions"]};
+        splitBuffers.setBuffers(splitIons);
+
+        // the two phases are made by different updaters, as by different threads
+        AsideParticles aside;
+        IonUpdater{dict}.updateBorder(splitIons, this->EM, this->layout, this->dt, mode, aside);
+        IonUpdater{dict}.updateBulk(splitIons, this->EM, this->layout, this->dt, mode, aside);
+        if (mode == UpdaterMode::all)
+            IonUpdater{dict}.mergeBulk(splitIons, aside);
+
+        IonsBuffers<dim, interpOrder> buffers{this->ionsBuffers, this->layout};
+        Ions ions{init_dict["ions"]};
+        buffers.setBuffers(ions);
+
+        AsideParticles expectedAside;
+        IonUpdater ionUpdater{dict};
+        ionUpdater.updatePopulations(ions, this->EM, this->layout, this->dt, mode);
+        if (mode == UpdaterMode::domain_only)
+            ionUpdater.setAside(ions, expectedAside);
+
+        for (std::size_t iPop = 0; iPop < ions.nbrPopulations(); ++iPop)
+        {
+            auto& splitPop = splitIons.getRunTimeResourcesUserList()[iPop];
+            auto& pop      = ions.getRunTimeResourcesUserList()[iPop];
+
+            EXPECT_EQ(sorted(splitPop.domainParticles()), sorted(pop.domainParticles()));
+            EXPECT_EQ(sorted(splitPop.patchGhostParticles()), sorted(pop.patchGhostParticles()));
+            if (mode == UpdaterMode::domain_only)
+            {
+                EXPECT_EQ(sorted(aside.domain[iPop]), sorted(expectedAside.domain[iPop]));
+            }
+
+            auto check = [](auto const& field, auto const& expected) {
+                for (std::size_t i = 0; i < field.size(); ++i)
+                    EXPECT_NEAR(field.data()[i], expected.data()[i], 1e-12);
+            };
+            check(splitPop.density(), pop.density());
+            for (auto component : {Component::X, Component::Y, Component::Z})
+                check(splitPop.flux().getComponent(component), pop.flux().getComponent(component));
+        }
+    }
+}
+
+
+
+
 TYPED_TEST(IonUpdaterTest, momentsAreChangedInMomentsOnlyMode)
 {
     typename IonUpdaterTest<TypeParam>::IonUpdater ionUpdater{
@@ -13,6 +13,7 @@
 #include "core/data/particles/particle_array.h"
 #include "core/numerics/boundary_condition/boundary_condition.h"
 #include "core/numerics/pusher/boris.h"
+#include "core/numerics/pusher/boris_simd.h"
 #include "core/numerics/pusher/pusher_factory.h"
 #include "core/utilities/range/range.h"
 #include "core/utilities/box/box.h"
@@ -71,17 +72,22 @@ Trajectory readExpectedTrajectory()
 class Interpolator
 {
 public:
-    template<typename PartIterator, typename Electromag, typename GridLayout>
-    void operator()(PartIterator begin, PartIterator end, Electromag const&, GridLayout&)
+    template<typename Particle, typename Electromag, typename GridLayout>
+    auto operator()(Particle const&, Electromag const&, GridLayout const&)
     {
-        for (auto currPart = begin; currPart != end; ++currPart)
+        return std::array<std::array<double, 3>, 2>{{{0.01, -0.05, 0.05}, {1., 1., 1.}}};
+    }
+
+    template<typename PartIterator, typename Electromag, typename GridLayout, typename Lanes>
+    void gather(PartIterator, std::size_t size, Electromag const&, GridLayout const&, Lanes& E,
+                Lanes& B)
+    {
+        for (std::size_t i = 0; i < size; ++i)
         {
-            currPart->Ex = 0.01;
-            currPart->Ey = -0.05;
-            currPart->Ez = 0.05;
-            currPart->Bx = 1.;
-            currPart->By = 1.;
-            currPart->Bz = 1.;
+            E[0][i] = 0.01;
+            E[1][i] = -0.05;
+            E[2][i] = 0.05;
+            B[0][i] = B[1][i] = B[2][i] = 1.;
         }
     }
 };
@@ -296,6 +302,53 @@ protected:
     Box<double, 1> domain;
     Box<int, 1> cells;
     BoundaryCondition<1, 1> bc;
+
+
+    // pushes particlesIn with move() and moveAndDeposit() of the given pusher, and checks
+    // the fused push keeps and deposits the particles move() keeps, in the order they are stored
+    template<typename Pusher_>
+    void expectFusedPushToDepositWhatMoveKeeps(Pusher_& fusedPusher)
+    {
+        std::copy(std::begin(particlesIn), std::end(particlesIn), std::begin(particlesOut1));
+        std::copy(std::begin(particlesIn), std::end(particlesIn), std::begin(particlesOut2));
+
+        auto selector = [this](Particle<1> const& part) {
+            return PHARE::core::isIn(cellAsPoint(part), cells);
+        };
+
+        auto rangeIn   = makeRange(std::begin(particlesIn), std::end(particlesIn));
+        auto rangeOut1 = makeRange(std::begin(particlesOut1), std::end(particlesOut1));
+        auto rangeOut2 = makeRange(std::begin(particlesOut2), std::end(particlesOut2));
+        auto layout    = DummyLayout<1>{};
+
+        using Iterator = ParticleArray<1>::iterator;
+        std::vector<double> deposited;
+        auto deposit = [&](Iterator first, Iterator last) {
+            for (auto it = first; it != last; ++it)
+                deposited.push_back(it->iCell[0] + it->delta[0]);
+        };
+
+        auto newEnd1
+            = fusedPusher.move(rangeIn, rangeOut1, em, mass, interpolator, selector, layout);
+        auto newEnd2 = fusedPusher.moveAndDeposit(rangeIn, rangeOut2, em, mass, interpolator,
+                                                  selector, deposit, layout);
+
+        std::vector<double> kept1, kept2;
+        for (auto it = std::begin(particlesOut1); it != newEnd1; ++it)
+            kept1.push_back(it->iCell[0] + it->delta[0]);
+        for (auto it = std::begin(particlesOut2); it != newEnd2; ++it)
+            kept2.push_back(it->iCell[0] + it->delta[0]);
+
+        // kept particles are deposited once, in the order they are stored
+        EXPECT_EQ(kept2, deposited);
+
+        // move() partitions particles, the fused push keeps their order
+        std::sort(std::begin(kept1), std::end(kept1));
+        auto sorted2 = kept2;
+        std::sort(std::begin(sorted2), std::end(sorted2));
+        EXPECT_GT(kept1.size(), 0u);
+        EXPECT_EQ(kept1, sorted2);
+    }
 };
 
 
@@ -368,6 +421,78 @@ TEST_F(APusherWithLeavingParticles, pusherWithOrWithoutBCReturnsSameNbrOfStaying
 
 
 
+TEST_F(APusherWithLeavingParticles, simdPusherGivesSameParticlesAsScalarPusher)
+{
+    using SimdPusher = BorisSimdPusher<1, ParticleArray<1>::iterator, Electromag, Interpolator,
+                                       BoundaryCondition<1, 1>, DummyLayout<1>>;
+    SimdPusher simdPusher;
+    simdPusher.setMeshAndTimeStep({{dx}}, dt);
+
+    // not a multiple of the batch size so that the last batch is partial
+    particlesIn.erase(std::begin(particlesIn) + 1, std::begin(particlesIn) + 4);
+    std::copy(std::begin(particlesIn), std::end(particlesIn), std::begin(particlesOut1));
+    std::copy(std::begin(particlesIn), std::end(particlesIn), std::begin(particlesOut2));
+    particlesOut1.resize(particlesIn.size());
+    particlesOut2.resize(particlesIn.size());
+
+    auto selector
+        = [this](Particle<1> const& part) { return PHARE::core::isIn(cellAsPoint(part), cells); };
+
+    auto rangeIn   = makeRange(std::begin(particlesIn), std::end(particlesIn));
+    auto rangeOut1 = makeRange(std::begin(particlesOut1), std::end(particlesOut1));
+    auto rangeOut2 = makeRange(std::begin(particlesOut2), std::end(particlesOut2));
+    auto layout    = DummyLayout<1>{};
+
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        auto newEnd1 = pusher->move(rangeIn, rangeOut1, em, mass, interpolator, selector, layout);
+        auto newEnd2
+            = simdPusher.move(rangeIn, rangeOut2, em, mass, interpolator, selector, layout);
+
+        ASSERT_EQ(std::distance(std::begin(particlesOut1), newEnd1),
+                  std::distance(std::begin(particlesOut2), newEnd2));
+
+        // identical unless the compiler contracts operations differently (e.g. FMA)
+        for (std::size_t iPart = 0; iPart < particlesOut1.size(); ++iPart)
+        {
+            auto const& scalar = particlesOut1[iPart];
+            auto const& simd   = particlesOut2[iPart];
+            ASSERT_NEAR(scalar.iCell[0] + scalar.delta[0], simd.iCell[0] + simd.delta[0], 1e-12);
+            ASSERT_THAT(scalar.v, ::testing::Pointwise(::testing::DoubleNear(1e-12), simd.v));
+        }
+
+        std::copy(std::begin(particlesOut1), std::end(particlesOut1), std::begin(particlesIn));
+    }
+}
+
+
+
+
+TEST_F(APusherWithLeavingParticles, fusedSimdPushDepositsTheParticlesMoveKeeps)
+{
+    using SimdPusher = BorisSimdPusher<1, ParticleArray<1>::iterator, Electromag, Interpolator,
+                                       BoundaryCondition<1, 1>, DummyLayout<1>>;
+    SimdPusher simdPusher;
+    simdPusher.setMeshAndTimeStep({{dx}}, dt);
+
+    expectFusedPushToDepositWhatMoveKeeps(simdPusher);
+}
+
+
+
+
+TEST_F(APusherWithLeavingParticles, fusedBorisPushDepositsTheParticlesMoveKeeps)
+{
+    // more particles than a block, and not a multiple of it, so that the last block is partial
+    ASSERT_GT(particlesIn.size(), pusher->block_size);
+    ASSERT_NE(0u, particlesIn.size() % pusher->block_size);
+
+    expectFusedPushToDepositWhatMoveKeeps(*pusher);
+}
+
+
+
+
 TEST(APusherFactory, canReturnABorisPusher)
 {
     auto pusher
@@ -378,6 +503,16 @@ TEST(APusherFactory, canReturnABorisPusher)
 }
 
 
+TEST(APusherFactory, canReturnABorisSimdPusher)
+{
+    auto pusher
+        = PusherFactory::makePusher<1, ParticleArray<1>::iterator, Electromag, Interpolator,
+                                    BoundaryCondition<1, 1>, DummyLayout<1>>("modified_boris_simd");
+
+    EXPECT_NE(nullptr, pusher);
+}
+
+
 
 int main(int argc, char** argv)
 {
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "core/utilities/box/box.h"
+#include "core/utilities/box/cell_indexer.h"
 #include "core/utilities/point/point.h"
 
 #include "gmock/gmock.h"
@@ -169,6 +170,46 @@ TEST(HollowBox2d, growSmaller)
 
 
 
+TEST(CellIndexer, numbersCellsWithTheLastDirectionVaryingFastest)
+{
+    CellIndexer<3> index{Box<int, 3>{Point<int, 3>{-1, 0, 2}, Point<int, 3>{1, 3, 6}}};
+
+    EXPECT_EQ(index.size(), 3u * 4u * 5u);
+    EXPECT_EQ(index(Point<int, 3>{-1, 0, 2}), 0u);
+    EXPECT_EQ(index(Point<int, 3>{-1, 0, 3}), 1u);
+    EXPECT_EQ(index(Point<int, 3>{-1, 1, 2}), 5u);
+    EXPECT_EQ(index(Point<int, 3>{0, 0, 2}), 20u);
+    EXPECT_EQ(index(Point<int, 3>{1, 3, 6}), index.size() - 1);
+}
+
+
+
+
+TEST(CellIndexer, numbersCellsWithTheFirstDirectionVaryingFastest)
+{
+    CellIndexer<3, true> index{Box<int, 3>{Point<int, 3>{-1, 0, 2}, Point<int, 3>{1, 3, 6}}};
+
+    EXPECT_EQ(index(Point<int, 3>{-1, 0, 2}), 0u);
+    EXPECT_EQ(index(Point<int, 3>{0, 0, 2}), 1u);
+    EXPECT_EQ(index(Point<int, 3>{-1, 1, 2}), 3u);
+    EXPECT_EQ(index(Point<int, 3>{-1, 0, 3}), 12u);
+    EXPECT_EQ(index(Point<int, 3>{1, 3, 6}), index.size() - 1);
+}
+
+
+
+
+TEST(CellIndexer, numbersCellsOutsideTheBoxWithItsSize)
+{
+    CellIndexer<2> index{Box<int, 2>{Point<int, 2>{0, 0}, Point<int, 2>{9, 9}}};
+
+    for (auto const& cell : {Point<int, 2>{-1, 0}, Point<int, 2>{0, 10}, Point<int, 2>{10, 10}})
+        EXPECT_EQ(index(cell), index.size());
+}
+
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
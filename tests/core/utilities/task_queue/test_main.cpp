@@ -0,0 +1,114 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/utilities/task_queue.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace PHARE::core;
+
+
+class ATaskQueue : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+
+TEST_P(ATaskQueue, runsTasksInPushOrder)
+{
+    TaskQueue queue{GetParam()};
+    std::vector<int> order;
+
+    for (int i = 0; i < 100; ++i)
+        queue.push([&order, i]() { order.push_back(i); });
+    queue.wait();
+
+    ASSERT_EQ(order.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(order[i], i);
+}
+
+
+TEST_P(ATaskQueue, neverHoldsMoreThanCapacityTasks)
+{
+    TaskQueue queue{GetParam()};
+    std::atomic<int> pushed{0}, done{0};
+    std::atomic<bool> release{false};
+
+    queue.push([&]() {
+        while (!release)
+            std::this_thread::yield();
+        ++done;
+    });
+
+    std::thread producer{[&]() {
+        for (std::size_t i = 0; i < queue.capacity() + 1; ++i)
+        {
+            queue.push([&]() { ++done; });
+            ++pushed;
+        }
+    }};
+
+    // the first task is running, the queue fills up and the last push blocks
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(pushed, static_cast<int>(queue.capacity()));
+
+    release = true;
+    producer.join();
+    queue.wait();
+    EXPECT_EQ(done, static_cast<int>(queue.capacity()) + 2);
+}
+
+
+TEST_P(ATaskQueue, releasesWhatTasksOwnBeforeWaitReturns)
+{
+    TaskQueue queue{GetParam()};
+    auto owned       = std::make_shared<int>(1);
+    std::weak_ptr<int> observer = owned;
+
+    queue.push([owned = std::move(owned)]() {});
+    queue.wait();
+
+    EXPECT_TRUE(observer.expired());
+}
+
+
+TEST_P(ATaskQueue, rethrowsExceptionsOfTasks)
+{
+    TaskQueue queue{GetParam()};
+
+    queue.push([]() { throw std::runtime_error("task"); });
+    EXPECT_THROW(queue.wait(), std::runtime_error);
+
+    std::atomic<int> count{0};
+    for (int i = 0; i < 10; ++i)
+        queue.push([&]() { ++count; });
+    queue.wait();
+    EXPECT_EQ(count, 10);
+}
+
+
+TEST_P(ATaskQueue, runsRemainingTasksAtDestruction)
+{
+    std::atomic<int> count{0};
+    {
+        TaskQueue queue{GetParam()};
+        for (int i = 0; i < 10; ++i)
+            queue.push([&]() { ++count; });
+    }
+    EXPECT_EQ(count, 10);
+}
+
+
+INSTANTIATE_TEST_SUITE_P(TaskQueue, ATaskQueue, ::testing::Values(1, 2, 8));
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "core/utilities/thread_pool.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace PHARE::core;
+
+
+class AThreadPool : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+
+TEST_P(AThreadPool, runsEachIterationOnce)
+{
+    ThreadPool pool{GetParam()};
+    EXPECT_EQ(pool.size(), GetParam());
+
+    for (std::size_t size : {0u, 1u, 3u, 1000u}) // pool is reused
+    {
+        std::vector<std::atomic<int>> counts(size);
+        pool.parallel_for(size, [&](std::size_t i, std::size_t) { ++counts[i]; });
+
+        for (auto const& count : counts)
+            EXPECT_EQ(count, 1);
+    }
+}
+
+
+TEST_P(AThreadPool, givesThreadIndexesInPoolSize)
+{
+    ThreadPool pool{GetParam()};
+    std::vector<std::size_t> sums(pool.size(), 0);
+
+    // each thread only writes its own sum
+    pool.parallel_for(1000, [&](std::size_t i, std::size_t threadIdx) {
+        ASSERT_LT(threadIdx, pool.size());
+        sums[threadIdx] += i;
+    });
+
+    EXPECT_EQ(std::accumulate(std::begin(sums), std::end(sums), std::size_t{0}), 999 * 1000 / 2);
+}
+
+
+TEST_P(AThreadPool, rethrowsExceptionsOfIterations)
+{
+    ThreadPool pool{GetParam()};
+
+    auto throwOn7 = [](std::size_t i, std::size_t) {
+        if (i == 7)
+            throw std::runtime_error("seven");
+    };
+    EXPECT_THROW(pool.parallel_for(100, throwOn7), std::runtime_error);
+
+    std::atomic<std::size_t> count{0};
+    pool.parallel_for(100, [&](std::size_t, std::size_t) { ++count; });
+    EXPECT_EQ(count, 100);
+}
+
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, AThreadPool, ::testing::Values(1, 2, 4));
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
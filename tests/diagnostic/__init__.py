@@ -11,7 +11,7 @@ def all_timestamps(sim):
     return sim.time_step * np.arange(nbr_dump_step)
 
 
-def dump_all_diags(pops=[], flush_every=100):
+def dump_all_diags(pops=[], flush_every=100, **kwargs):
     import pyphare.pharein as ph, numpy as np
 
     sim = ph.global_vars.sim
@@ -24,6 +24,7 @@ def dump_all_diags(pops=[], flush_every=100):
             write_timestamps=timestamps,
             compute_timestamps=timestamps,
             flush_every=flush_every,
+            **kwargs,
         )
 
     for pop in pops:
@@ -33,6 +34,7 @@ def dump_all_diags(pops=[], flush_every=100):
               write_timestamps=timestamps,
               compute_timestamps=timestamps,
               flush_every=flush_every,
+              **kwargs,
               population_name=pop
           )
 
@@ -42,6 +44,7 @@ def dump_all_diags(pops=[], flush_every=100):
                 compute_timestamps=timestamps,
                 write_timestamps=timestamps,
                 flush_every=flush_every,
+                **kwargs,
                 population_name=pop
             )
 
@@ -51,4 +54,5 @@ def dump_all_diags(pops=[], flush_every=100):
             write_timestamps=timestamps,
             compute_timestamps=timestamps,
             flush_every=flush_every,
+            **kwargs,
         )
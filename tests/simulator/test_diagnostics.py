@@ -11,8 +11,10 @@ from pyphare.pharein import ElectronModel
 from pyphare.simulator.simulator import Simulator, startMPI
 from pyphare.pharein.simulation import supported_dimensions
 from pyphare.pharesee.hierarchy import hierarchy_from, h5_filename_from, h5_time_grp_key
+from pyphare.pharesee.level_layout import is_level_layout
 import pyphare.pharein as ph
 import unittest
+import copy
 import os
 import h5py
 import numpy as np
@@ -128,7 +130,36 @@ class DiagnosticsTest(unittest.TestCase):
         for ndim in supported_dimensions():
             self._test_dump_diags(ndim, **simInput)
 
-    def _test_dump_diags(self, dim, **simInput):
+    def test_dump_diags_level_layout(self):
+        simInput = copy.deepcopy(dup({"smallest_patch_size": 10, "largest_patch_size": 20}))
+        simInput["diag_options"]["options"]["layout"] = "level"
+        for ndim in supported_dimensions():
+            self._test_dump_diags(ndim, **copy.deepcopy(simInput))
+
+    def test_dump_diags_compressed(self):
+        diag_kwargs = {"chunk_size": 64, "compression": 4, "float32": True}
+        for ndim in supported_dimensions():
+            simInput = copy.deepcopy(dup({"smallest_patch_size": 10, "largest_patch_size": 20}))
+            if cpp.mpi_size() == 1:
+                self._test_dump_diags(ndim, diag_kwargs=diag_kwargs, **simInput)
+            else: # parallel HDF5 only compresses collective writes, the writer refuses
+                self._test_dump_diags_compression_refused(ndim, diag_kwargs, **simInput)
+
+    def _test_dump_diags_compression_refused(self, dim, diag_kwargs, **simInput):
+        for key in ["cells", "dl", "boundary_types"]:
+            simInput[key] = [simInput[key] for d in range(dim)]
+        simInput["diag_options"]["options"]["dir"] = \
+            f"{out}_dim{dim}_mpi_n_{cpp.mpi_size()}_id{self.ddt_test_id()}"
+
+        simulation = ph.Simulation(**simInput)
+        dump_all_diags(setup_model().populations, **diag_kwargs)
+        self.simulator = Simulator(simulation)
+        self.assertRaises(ValueError, self.simulator.initialize)
+        self.simulator.reset()
+        self.simulator = None
+        ph.global_vars.sim = None
+
+    def _test_dump_diags(self, dim, diag_kwargs={}, **simInput):
         test_id = self.ddt_test_id()
 
         # configure simulation dim sized values
@@ -150,7 +181,7 @@ class DiagnosticsTest(unittest.TestCase):
             simulation = ph.Simulation(**simInput)
             self.assertTrue(len(simulation.cells) == dim)
 
-            dump_all_diags(setup_model().populations)
+            dump_all_diags(setup_model().populations, **diag_kwargs)
             self.simulator = Simulator(simulation).initialize().advance().reset()
 
             refined_particle_nbr = simulation.refined_particle_nbr
@@ -166,6 +197,11 @@ class DiagnosticsTest(unittest.TestCase):
 
                 h5_file = h5py.File(h5_filepath, "r")
 
+                layout = simInput["diag_options"]["options"].get("layout", "patch")
+                self.assertEqual(is_level_layout(h5_file), layout == "level")
+                if diag_kwargs:
+                    self._check_dataset_options(h5_file, **diag_kwargs)
+
                 self.assertTrue("0.0000000000" in h5_file[h5_time_grp_key]) # init dump
                 self.assertTrue("0.0010000000" in h5_file[h5_time_grp_key]) # first advance dump
 
@@ -201,6 +237,61 @@ class DiagnosticsTest(unittest.TestCase):
             ph.global_vars.sim = None
 
 
+    def _check_dataset_options(self, h5_file, chunk_size, compression, float32):
+        def check(name, dataset):
+            if not isinstance(dataset, h5py.Dataset):
+                return
+            self.assertIsNotNone(dataset.chunks)
+            self.assertLessEqual(dataset.chunks[0], chunk_size)
+            self.assertEqual(dataset.compression, "gzip")
+            self.assertEqual(dataset.compression_opts, compression)
+            key = name.split("/")[-1]
+            if key == "v" or key.startswith("EM_") or key == "density":
+                self.assertEqual(dataset.dtype, np.float32)
+
+        h5_file[h5_time_grp_key].visititems(check)
+
+
+    def test_dump_particles_selection(self):
+        select_box = [[12], [15]]
+        for ndim in supported_dimensions():
+            simInput = copy.deepcopy(dup({"smallest_patch_size": 10, "largest_patch_size": 20}))
+            for key in ["cells", "dl", "boundary_types"]:
+                simInput[key] = [simInput[key] for d in range(ndim)]
+            simInput["refinement_boxes"] = {"L0": {"B0": [[10] * ndim, [19] * ndim]}}
+            local_out = f"{out}_dim{ndim}_mpi_n_{cpp.mpi_size()}_id{self.ddt_test_id()}"
+            simInput["diag_options"]["options"]["dir"] = local_out
+
+            simulation = ph.Simulation(**simInput)
+            model = setup_model()
+            box = [select_box[0] * ndim, select_box[1] * ndim]
+            for pop in model.populations:
+                ph.ParticleDiagnostics(quantity="domain", write_timestamps=np.asarray([0.]),
+                                       compute_timestamps=np.asarray([0.]), population_name=pop,
+                                       subsample=3, select_box=box)
+            self.simulator = Simulator(simulation).initialize().reset()
+
+            for diagInfo in ph.global_vars.sim.diagnostics:
+                h5_file = h5py.File(os.path.join(local_out, h5_filename_from(diagInfo)), "r")
+                nbr_particles = 0
+                for ilvl, lvl_key in enumerate(["pl0", "pl1"]):
+                    # the box is given on level 0, and refined on level 1
+                    lower = np.asarray(box[0]) * 2**ilvl
+                    upper = (np.asarray(box[1]) + 1) * 2**ilvl - 1
+                    lvl = h5_file[h5_time_grp_key]["0.0000000000"][lvl_key]
+                    for patch_key in lvl.keys():
+                        if "iCell" not in lvl[patch_key]:
+                            continue
+                        iCells = lvl[patch_key]["iCell"][:]
+                        self.assertEqual(lvl[patch_key]["weight"].shape[0], iCells.shape[0])
+                        self.assertTrue(np.all(iCells >= lower) and np.all(iCells <= upper))
+                        nbr_particles += iCells.shape[0]
+                self.assertGreater(nbr_particles, 0)
+
+            self.simulator = None
+            ph.global_vars.sim = None
+
+
 
     def test_twice_register(self):
         simulation = ph.Simulation(**simArgs.copy())
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+
+#
+# a simulation restarted from restart files must give, bit for bit, the data of the same
+# simulation run without interruption
+#
+
+from pyphare.cpp import cpp_lib
+cpp = cpp_lib()
+
+from pyphare.pharein import ElectronModel
+from pyphare.simulator.simulator import Simulator, startMPI
+from pyphare.pharein.simulation import supported_dimensions
+from pyphare.pharesee.hierarchy import h5_filename_from, h5_time_grp_key, hierarchy_from
+import pyphare.pharein as ph
+import unittest
+import copy
+import os
+import h5py
+import numpy as np
+
+
+def setup_model(ppc=50):
+    def density(*xyz):
+        return 1.
+
+    def bx(*xyz):
+        return 1.
+
+    def by(*xyz):
+        from pyphare.pharein.global_vars import sim
+        L = sim.simulation_domain()
+        _ = lambda i: 0.1*np.sin(2*np.pi*xyz[i]/L[i])
+        return np.asarray([_(i) for i,v in enumerate(xyz)]).prod(axis=0)
+
+    def bz(*xyz):
+        from pyphare.pharein.global_vars import sim
+        L = sim.simulation_domain()
+        _ = lambda i: 0.1*np.cos(2*np.pi*xyz[i]/L[i])
+        return np.asarray([_(i) for i,v in enumerate(xyz)]).prod(axis=0)
+
+    def v(*xyz):
+        return 0.
+
+    def vth(*xyz):
+        return 0.1
+
+    vvv = {
+        "vbulkx": v, "vbulky": v, "vbulkz": v,
+        "vthx": vth, "vthy": vth, "vthz": vth
+    }
+
+    model = ph.MaxwellianFluidModel(
+        bx=bx, by=by, bz=bz,
+        protons={"charge": 1, "density": density, **vvv, "nbr_part_per_cell":ppc, "init": {"seed": 1337}},
+        alpha={"mass": 4, "charge": 1, "density": density, **vvv, "nbr_part_per_cell":ppc, "init": {"seed": 2334}},
+    )
+    ElectronModel(closure="isothermal", Te=0.12)
+    return model
+
+
+def dump_final_diags(pops, final_time):
+    timestamps = np.asarray([final_time])
+    for quantity in ["E", "B"]:
+        ph.ElectromagDiagnostics(quantity=quantity, write_timestamps=timestamps,
+                                 compute_timestamps=timestamps)
+    for quantity in ["density", "bulkVelocity"]:
+        ph.FluidDiagnostics(quantity=quantity, write_timestamps=timestamps,
+                            compute_timestamps=timestamps)
+    for pop in pops:
+        for quantity in ["domain", "levelGhost", "patchGhost"]:
+            ph.ParticleDiagnostics(quantity=quantity, write_timestamps=timestamps,
+                                   compute_timestamps=timestamps, population_name=pop)
+
+
+out = "phare_outputs/restarts_test/"
+time_step_nbr = 10
+restart_step = 5
+simArgs = {
+  "time_step_nbr": time_step_nbr,
+  "time_step": 0.001,
+  "boundary_types": "periodic",
+  "cells": 30,
+  "dl": 0.3,
+  "smallest_patch_size": 10,
+  "largest_patch_size": 20,
+  "diag_options": {"format": "phareh5", "options": {"dir": out, "mode": "overwrite"}},
+}
+
+
+class RestartsTest(unittest.TestCase):
+
+    def __init__(self, *args, **kwargs):
+        super(RestartsTest, self).__init__(*args, **kwargs)
+        startMPI()
+        self.simulator = None
+
+
+    def tearDown(self):
+        if self.simulator is not None:
+            self.simulator.reset()
+        self.simulator = None
+        ph.global_vars.sim = None
+
+
+    def run_simulation(self, ndim, diag_dir, restart_options):
+        simInput = copy.deepcopy(simArgs)
+        for key in ["cells", "dl", "boundary_types"]:
+            simInput[key] = [simInput[key] for d in range(ndim)]
+        simInput["refinement_boxes"] = {"L0": {"B0": [[10] * ndim, [19] * ndim]}}
+        simInput["diag_options"]["options"]["dir"] = diag_dir
+        simInput["restart_options"] = restart_options
+
+        simulation = ph.Simulation(**simInput)
+        model = setup_model()
+        dump_final_diags(model.populations, simulation.final_time)
+
+        self.simulator = Simulator(simulation).initialize()
+        self.simulator.run()
+        self.simulator = None
+
+        diag_files = [h5_filename_from(diagInfo) for diagInfo in ph.global_vars.sim.diagnostics]
+        ph.global_vars.sim = None
+        return diag_files
+
+
+    def assert_identical(self, uninterrupted_file, restarted_file):
+        with h5py.File(uninterrupted_file, "r") as uninterrupted:
+            with h5py.File(restarted_file, "r") as restarted:
+                time_groups = uninterrupted[h5_time_grp_key]
+                self.assertEqual(len(time_groups), 1)
+
+                def check(name, dataset):
+                    if isinstance(dataset, h5py.Dataset):
+                        self.assertTrue(np.array_equal(dataset[:], restarted[h5_time_grp_key][name][:]),
+                                        f"{restarted_file} {name} differs")
+
+                time_groups.visititems(check)
+
+
+    def assert_close(self, uninterrupted_file, restarted_file):
+        """
+        restarting on another number of ranks regrids the restarted levels,
+        the data then only match up to round off errors
+        """
+        if os.path.basename(uninterrupted_file).startswith("EM_B"):
+            uninterrupted, restarted = [node_values(diag_file, ["Bx", "By", "Bz"])
+                                        for diag_file in [uninterrupted_file, restarted_file]]
+            self.assertEqual(uninterrupted.keys(), restarted.keys())
+            for node, value in uninterrupted.items():
+                self.assertTrue(np.allclose(value, restarted[node], rtol=0, atol=1e-10),
+                                f"{restarted_file} B differs at {node}")
+
+        elif os.path.basename(uninterrupted_file).endswith("domain.h5"):
+            self.assertEqual(particle_counts(uninterrupted_file), particle_counts(restarted_file),
+                             f"{restarted_file} particle counts differ")
+
+
+    def test_restarted_simulation_is_identical_to_uninterrupted_one(self):
+        for ndim in supported_dimensions():
+            local_out = f"{out}dim{ndim}_mpi_n_{cpp.mpi_size()}"
+            restart_dir = f"{local_out}/restarts"
+
+            uninterrupted_files = self.run_simulation(ndim, f"{local_out}/uninterrupted",
+                                                      {"dir": restart_dir, "interval": restart_step})
+
+            restarted_files = self.run_simulation(ndim, f"{local_out}/restarted",
+                                                  {"dir": restart_dir, "restart_index": restart_step})
+
+            self.assertEqual(uninterrupted_files, restarted_files)
+            for diag_file in uninterrupted_files:
+                self.assert_identical(os.path.join(f"{local_out}/uninterrupted", diag_file),
+                                      os.path.join(f"{local_out}/restarted", diag_file))
+
+
+    def test_simulation_restarted_on_another_number_of_ranks_is_close_to_uninterrupted_one(self):
+        """
+        restarts, on more than one rank, from the restart files the serial run of this
+        test writes, see test_restarted_simulation_is_identical_to_uninterrupted_one
+        """
+        if cpp.mpi_size() == 1:
+            self.skipTest("restarts serial restart files on more than one rank")
+
+        for ndim in supported_dimensions():
+            serial_out = f"{out}dim{ndim}_mpi_n_1"
+            restart_dir = f"{serial_out}/restarts"
+            if not os.path.isdir(restart_dir):
+                self.skipTest(f"no serial restart files in {restart_dir}")
+
+            restarted_dir = f"{out}dim{ndim}_mpi_n_{cpp.mpi_size()}/restarted_from_mpi_n_1"
+            restarted_files = self.run_simulation(ndim, restarted_dir,
+                                                  {"dir": restart_dir, "restart_index": restart_step})
+
+            for diag_file in restarted_files:
+                self.assert_close(os.path.join(f"{serial_out}/uninterrupted", diag_file),
+                                  os.path.join(restarted_dir, diag_file))
+
+
+def node_values(diag_file, quantities):
+    """
+    returns {(level, quantity, AMR index): value} for the nodes of the patch boxes of all levels
+    """
+    hier = hierarchy_from(h5_filename=diag_file)
+    values = {}
+    for ilvl, level in hier.levels().items():
+        for patch in level.patches:
+            for qty in quantities:
+                data = patch.patch_datas[qty][patch.box]
+                for local, value in np.ndenumerate(data):
+                    values[(ilvl, qty, tuple(patch.box.lower + np.asarray(local)))] = value
+    return values
+
+
+def particle_counts(diag_file):
+    """
+    returns {level: number of particles} of a particle diagnostic file
+    """
+    counts = {}
+    with h5py.File(diag_file, "r") as h5_file:
+        def count(name, dataset):
+            if isinstance(dataset, h5py.Dataset) and name.endswith("weight"):
+                level = next(key for key in name.split("/") if key.startswith("pl"))
+                counts[level] = counts.get(level, 0) + dataset.shape[0]
+
+        h5_file[h5_time_grp_key].visititems(count)
+    return counts
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,167 @@
+#include "benchmark/benchmark.h"
+
+#include "phare_core.h"
+#include "core/numerics/interpolator/interpolator.h"
+
+#include <random>
+
+template<std::size_t dim>
+using Field = PHARE::core::Field<PHARE::core::NdArrayVector<dim>,
+                                 typename PHARE::core::HybridQuantity::Scalar>;
+template<std::size_t dim>
+using VecField
+    = PHARE::core::VecField<PHARE::core::NdArrayVector<dim>, typename PHARE::core::HybridQuantity>;
+
+constexpr std::uint32_t cells = 65;
+constexpr std::uint32_t parts = 1e6;
+
+template<std::size_t dim, typename ParticleArray>
+void fillParticles(ParticleArray& particles)
+{
+    std::mt19937_64 gen{1};
+    std::uniform_int_distribution<int> cell(0, cells - 1);
+    std::uniform_real_distribution<double> delta(0, 1);
+
+    for (std::size_t i = 0; i < parts; ++i)
+    {
+        PHARE::core::Particle<dim> particle{/*.weight = */ 1, /*.charge = */ 1};
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            particle.iCell[iDim] = cell(gen);
+            particle.delta[iDim] = delta(gen);
+        }
+        particle.v = {{1, 2, 3}};
+        particles.push_back(particle);
+    }
+}
+
+template<typename GridLayout, typename Quantity, std::size_t dim = GridLayout::dimension>
+Field<dim> field(std::string key, Quantity type, GridLayout const& layout)
+{
+    Field<dim> feeld{key, type, layout.allocSize(type)};
+    std::fill(feeld.begin(), feeld.end(), 1);
+    return feeld;
+}
+
+
+template<std::size_t dim, std::size_t interp>
+struct InterpolatorBench
+{
+    using PHARE_Types   = PHARE::core::PHARE_Types<dim, interp>;
+    using GridLayout_t  = typename PHARE_Types::GridLayout_t;
+    using ParticleArray = typename PHARE_Types::ParticleArray_t;
+    using Quantity      = PHARE::core::HybridQuantity::Scalar;
+
+    InterpolatorBench()
+    {
+        fillParticles<dim>(particles);
+
+        em.B.setBuffer("EM_B_x", &bx);
+        em.B.setBuffer("EM_B_y", &by);
+        em.B.setBuffer("EM_B_z", &bz);
+        em.E.setBuffer("EM_E_x", &ex);
+        em.E.setBuffer("EM_E_y", &ey);
+        em.E.setBuffer("EM_E_z", &ez);
+
+        flux.setBuffer("F_x", &fx);
+        flux.setBuffer("F_y", &fy);
+        flux.setBuffer("F_z", &fz);
+    }
+
+    GridLayout_t layout{PHARE::core::ConstArray<double, dim>(1.0 / cells),
+                        PHARE::core::ConstArray<std::uint32_t, dim>(cells),
+                        PHARE::core::Point<double, dim>{PHARE::core::ConstArray<double, dim>(0)}};
+
+    ParticleArray particles;
+    PHARE::core::Interpolator<dim, interp> interpolator;
+
+    Field<dim> bx = field("Bx", Quantity::Bx, layout);
+    Field<dim> by = field("By", Quantity::By, layout);
+    Field<dim> bz = field("Bz", Quantity::Bz, layout);
+    Field<dim> ex = field("Ex", Quantity::Ex, layout);
+    Field<dim> ey = field("Ey", Quantity::Ey, layout);
+    Field<dim> ez = field("Ez", Quantity::Ez, layout);
+    PHARE::core::Electromag<VecField<dim>> em{std::string{"EM"}};
+
+    Field<dim> rho = field("rho", Quantity::rho, layout);
+    Field<dim> fx  = field("Fx", Quantity::Vx, layout);
+    Field<dim> fy  = field("Fy", Quantity::Vy, layout);
+    Field<dim> fz  = field("Fz", Quantity::Vz, layout);
+    VecField<dim> flux{"F", PHARE::core::HybridQuantity::Vector::V};
+};
+
+
+template<std::size_t dim, std::size_t interp>
+void gather(benchmark::State& state)
+{
+    InterpolatorBench<dim, interp> bench;
+
+    while (state.KeepRunning())
+        for (auto const& particle : bench.particles)
+            benchmark::DoNotOptimize(bench.interpolator(particle, bench.em, bench.layout));
+}
+
+template<std::size_t dim, std::size_t interp>
+void gatherBatch(benchmark::State& state)
+{
+    InterpolatorBench<dim, interp> bench;
+    constexpr auto batch_size = PHARE::core::Interpolator<dim, interp>::batch_size;
+    std::array<std::array<double, batch_size>, 3> E, B;
+
+    while (state.KeepRunning())
+        for (std::size_t start = 0; start < parts; start += batch_size)
+        {
+            auto const size = std::min<std::size_t>(batch_size, parts - start);
+            bench.interpolator.gather(std::begin(bench.particles) + start, size, bench.em,
+                                      bench.layout, E, B);
+            benchmark::DoNotOptimize(E);
+            benchmark::DoNotOptimize(B);
+        }
+}
+
+template<std::size_t dim, std::size_t interp>
+void deposit(benchmark::State& state)
+{
+    InterpolatorBench<dim, interp> bench;
+
+    while (state.KeepRunning())
+        bench.interpolator(std::begin(bench.particles), std::end(bench.particles), bench.rho,
+                           bench.flux, bench.layout);
+}
+
+
+BENCHMARK_TEMPLATE(gather, /*dim=*/1, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/1, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/1, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/2, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/2, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/2, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/3, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/3, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/3, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/1, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/1, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/1, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/2, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/2, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/2, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/3, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/3, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gatherBatch, /*dim=*/3, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(deposit, /*dim=*/1, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/1, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/1, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/2, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/2, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/2, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/3, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/3, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/3, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
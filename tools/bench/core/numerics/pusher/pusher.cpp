@@ -3,6 +3,7 @@
 
 #include "phare_core.h"
 #include "core/numerics/pusher/boris.h"
+#include "core/numerics/pusher/boris_simd.h"
 #include "core/numerics/ion_updater/ion_updater.h"
 
 template<std::size_t dim>
@@ -31,7 +32,7 @@ Field<dim> field(std::string key, Quantity type, GridLayout const& layout)
     return feeld;
 }
 
-template<std::size_t dim, std::size_t interp>
+template<std::size_t dim, std::size_t interp, bool simd = false>
 void push(benchmark::State& state)
 {
     constexpr std::uint32_t cells = 65;
@@ -46,8 +47,12 @@ void push(benchmark::State& state)
     using ParticleArray     = typename Ions_t::particle_array_type;
     using PartIterator      = typename ParticleArray::iterator;
 
-    using BorisPusher_t = PHARE::core::BorisPusher<dim, PartIterator, Electromag_t, Interpolator,
-                                                   BoundaryCondition, GridLayout_t>;
+    using BorisPusher_t = std::conditional_t<
+        simd,
+        PHARE::core::BorisSimdPusher<dim, PartIterator, Electromag_t, Interpolator,
+                                     BoundaryCondition, GridLayout_t>,
+        PHARE::core::BorisPusher<dim, PartIterator, Electromag_t, Interpolator, BoundaryCondition,
+                                 GridLayout_t>>;
 
     Interpolator interpolator;
     ParticleArray domainParticles{parts, particle<dim>()};
@@ -101,6 +106,127 @@ BENCHMARK_TEMPLATE(push, /*dim=*/3, /*interp=*/1)->Unit(benchmark::kMicrosecond)
 BENCHMARK_TEMPLATE(push, /*dim=*/3, /*interp=*/2)->Unit(benchmark::kMicrosecond);
 BENCHMARK_TEMPLATE(push, /*dim=*/3, /*interp=*/3)->Unit(benchmark::kMicrosecond);
 
+BENCHMARK_TEMPLATE(push, /*dim=*/1, /*interp=*/1, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push, /*dim=*/1, /*interp=*/2, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push, /*dim=*/1, /*interp=*/3, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(push, /*dim=*/2, /*interp=*/1, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push, /*dim=*/2, /*interp=*/2, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push, /*dim=*/2, /*interp=*/3, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(push, /*dim=*/3, /*interp=*/1, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push, /*dim=*/3, /*interp=*/2, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push, /*dim=*/3, /*interp=*/3, /*simd=*/true)->Unit(benchmark::kMicrosecond);
+
+template<std::size_t dim, std::size_t interp, bool fused, bool simd = true>
+void push_and_deposit(benchmark::State& state)
+{
+    constexpr std::uint32_t cells = 65;
+    constexpr std::uint32_t parts = 1e7;
+
+    using PHARE_Types       = PHARE::core::PHARE_Types<dim, interp>;
+    using Interpolator      = PHARE::core::Interpolator<dim, interp>;
+    using BoundaryCondition = PHARE::core::BoundaryCondition<dim, interp>;
+    using Ions_t            = typename PHARE_Types::Ions_t;
+    using Electromag_t      = typename PHARE_Types::Electromag_t;
+    using GridLayout_t      = typename PHARE_Types::GridLayout_t;
+    using ParticleArray     = typename Ions_t::particle_array_type;
+    using PartIterator      = typename ParticleArray::iterator;
+    using Scalar            = PHARE::core::HybridQuantity::Scalar;
+
+    Interpolator interpolator;
+    ParticleArray domainParticles{parts, particle<dim>()};
+    ParticleArray tmpDomain{domainParticles.size(), particle<dim>()};
+
+    auto rangeIn  = PHARE::core::makeRange(domainParticles);
+    auto rangeOut = PHARE::core::makeRange(tmpDomain);
+
+    auto meshSize = PHARE::core::ConstArray<double, dim>(1.0 / cells);
+    auto nCells   = PHARE::core::ConstArray<std::uint32_t, dim>(cells);
+    auto origin   = PHARE::core::Point<double, dim>{PHARE::core::ConstArray<double, dim>(0)};
+    GridLayout_t layout{meshSize, nCells, origin};
+
+    Field<dim> bx = field("Bx", Scalar::Bx, layout);
+    Field<dim> by = field("By", Scalar::By, layout);
+    Field<dim> bz = field("Bz", Scalar::Bz, layout);
+
+    Field<dim> ex = field("Ex", Scalar::Ex, layout);
+    Field<dim> ey = field("Ey", Scalar::Ey, layout);
+    Field<dim> ez = field("Ez", Scalar::Ez, layout);
+
+    PHARE::core::Electromag<VecField<dim>> emFields{std::string{"EM"}};
+    emFields.B.setBuffer("EM_B_x", &bx);
+    emFields.B.setBuffer("EM_B_y", &by);
+    emFields.B.setBuffer("EM_B_z", &bz);
+    emFields.E.setBuffer("EM_E_x", &ex);
+    emFields.E.setBuffer("EM_E_y", &ey);
+    emFields.E.setBuffer("EM_E_z", &ez);
+
+    Field<dim> density = field("rho", Scalar::rho, layout);
+    Field<dim> fx      = field("flux_x", Scalar::Vx, layout);
+    Field<dim> fy      = field("flux_y", Scalar::Vy, layout);
+    Field<dim> fz      = field("flux_z", Scalar::Vz, layout);
+
+    VecField<dim> flux{"flux", PHARE::core::HybridQuantity::Vector::V};
+    flux.setBuffer("flux_x", &fx);
+    flux.setBuffer("flux_y", &fy);
+    flux.setBuffer("flux_z", &fz);
+
+    using BorisPusher_t = std::conditional_t<
+        simd,
+        PHARE::core::BorisSimdPusher<dim, PartIterator, Electromag_t, Interpolator,
+                                     BoundaryCondition, GridLayout_t>,
+        PHARE::core::BorisPusher<dim, PartIterator, Electromag_t, Interpolator, BoundaryCondition,
+                                 GridLayout_t>>;
+
+    BorisPusher_t pusher;
+    pusher.setMeshAndTimeStep(layout.meshSize(), .001);
+
+    auto selector = [](auto const& /*part*/) { return true; };
+    auto deposit  = [&](PartIterator first, PartIterator last) {
+        interpolator(first, last, density, flux, layout);
+    };
+
+    while (state.KeepRunning())
+    {
+        if constexpr (fused)
+        {
+            pusher.moveAndDeposit(rangeIn, rangeOut, emFields, 1, interpolator, selector, deposit,
+                                  layout);
+        }
+        else
+        {
+            auto end = pusher.move(rangeIn, rangeOut, emFields, 1, interpolator, selector, layout);
+            deposit(rangeOut.begin(), end);
+        }
+    }
+}
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/1, /*interp=*/1, /*fused=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/1, /*interp=*/1, /*fused=*/true)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/2, /*interp=*/1, /*fused=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/2, /*interp=*/1, /*fused=*/true)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/3, /*interp=*/1, /*fused=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/3, /*interp=*/1, /*fused=*/true)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/1, /*interp=*/1, /*fused=*/false, /*simd=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/1, /*interp=*/1, /*fused=*/true, /*simd=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/2, /*interp=*/1, /*fused=*/false, /*simd=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/2, /*interp=*/1, /*fused=*/true, /*simd=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/3, /*interp=*/1, /*fused=*/false, /*simd=*/false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(push_and_deposit, /*dim=*/3, /*interp=*/1, /*fused=*/true, /*simd=*/false)
+    ->Unit(benchmark::kMicrosecond);
+
 int main(int argc, char** argv)
 {
     ::benchmark::Initialize(&argc, argv);